@@ -206,11 +206,13 @@ let package = Package(
                 "Realm/RLMCollection.mm",
                 "Realm/RLMConstants.m",
                 "Realm/RLMDecimal128.mm",
+                "Realm/RLMDescriptionWriter.mm",
                 "Realm/RLMDictionary.mm",
                 "Realm/RLMEmbeddedObject.mm",
                 "Realm/RLMError.mm",
                 "Realm/RLMEvent.mm",
                 "Realm/RLMGeospatial.mm",
+                "Realm/RLMJSONImport.mm",
                 "Realm/RLMLogger.mm",
                 "Realm/RLMManagedArray.mm",
                 "Realm/RLMManagedDictionary.mm",
@@ -156,4 +156,124 @@ using namespace realm::bson;
     XCTAssertEqualObjects(RLMConvertBsonToRLMBSON(bsonDocument["uuid"]), document[@"uuid"]);
 }
 
+- (void)testDatetimeSubsecondPrecision {
+    auto bson = Bson(realm::Timestamp(42, 250'000'000));
+    NSDate *rlm = (NSDate *)RLMConvertBsonToRLMBSON(bson);
+    XCTAssertEqual(rlm.timeIntervalSince1970, 42.25);
+    XCTAssertEqual(RLMConvertRLMBSONToBson(rlm), bson);
+}
+
+- (void)testStringsAreNotTruncated {
+    auto bson = Bson(std::string("a\0b", 3));
+    NSString *rlm = (NSString *)RLMConvertBsonToRLMBSON(bson);
+    XCTAssertEqual(rlm.length, 3U);
+    XCTAssertEqualObjects((NSString *)RLMConvertBsonToRLMBSON(Bson(std::string())), @"");
+}
+
+- (void)testDocumentView {
+    NSDictionary *document = @{
+        @"string": @"foo",
+        @"int": @5,
+        @"nested": @{@"a": @1, @"b": @[@"x", @"y"]},
+        @"array": @[@{@"c": @2}, @[@3], @"z"],
+    };
+    RLMBSONDocumentView *view;
+    @autoreleasepool {
+        auto bson = static_cast<BsonDocument>(RLMConvertRLMBSONToBson(document));
+        view = [[RLMBSONDocumentView alloc] initWithDocument:std::make_shared<const BsonDocument>(std::move(bson))];
+    }
+
+    XCTAssertEqual(view.count, 4U);
+    XCTAssertEqualObjects([NSSet setWithArray:view.keys], [NSSet setWithArray:document.allKeys]);
+    XCTAssertTrue([view containsKey:@"string"]);
+    XCTAssertFalse([view containsKey:@"missing"]);
+    XCTAssertEqual([view typeForKey:@"string"], RLMBSONTypeString);
+    XCTAssertEqual([view typeForKey:@"int"], RLMBSONTypeInt32);
+    XCTAssertEqual([view typeForKey:@"nested"], RLMBSONTypeDocument);
+    XCTAssertEqual([view typeForKey:@"array"], RLMBSONTypeArray);
+    XCTAssertEqual([view typeForKey:@"missing"], RLMBSONTypeNull);
+    XCTAssertEqualObjects(view[@"string"], @"foo");
+    XCTAssertEqualObjects(view[@"int"], @5);
+    XCTAssertEqualObjects(view[@"nested"], document[@"nested"]);
+    XCTAssertNil(view[@"missing"]);
+    XCTAssertEqualObjects(view.dictionaryValue, document);
+
+    XCTAssertNil([view documentForKey:@"string"]);
+    XCTAssertNil([view documentForKey:@"missing"]);
+    XCTAssertNil([view arrayForKey:@"nested"]);
+
+    // Views of nested values remain valid after the parent view is gone
+    RLMBSONDocumentView *nested;
+    RLMBSONArrayView *array;
+    @autoreleasepool {
+        nested = [view documentForKey:@"nested"];
+        array = [view arrayForKey:@"array"];
+        view = nil;
+    }
+    XCTAssertEqual(nested.count, 2U);
+    XCTAssertEqualObjects(nested[@"a"], @1);
+    XCTAssertEqualObjects([nested arrayForKey:@"b"].arrayValue, (@[@"x", @"y"]));
+
+    XCTAssertEqual(array.count, 3U);
+    XCTAssertEqual([array typeAtIndex:0], RLMBSONTypeDocument);
+    XCTAssertEqual([array typeAtIndex:1], RLMBSONTypeArray);
+    XCTAssertEqual([array typeAtIndex:2], RLMBSONTypeString);
+    XCTAssertEqualObjects([array documentAtIndex:0][@"c"], @2);
+    XCTAssertNil([array documentAtIndex:1]);
+    XCTAssertEqualObjects([array arrayAtIndex:1][0], @3);
+    XCTAssertNil([array arrayAtIndex:2]);
+    XCTAssertEqualObjects(array[2], @"z");
+    XCTAssertEqualObjects(array.arrayValue, document[@"array"]);
+    XCTAssertThrows(array[3]);
+    XCTAssertThrows([array typeAtIndex:3]);
+}
+
+- (void)testDocumentViewTypedAccessors {
+    RLMObjectId *objectId = [RLMObjectId objectId];
+    NSUUID *uuid = [NSUUID UUID];
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:500.25];
+    RLMBSONDocumentView *view = [[RLMBSONDocumentView alloc] initWithDictionary:@{
+        @"bool": @YES,
+        @"int32": @5,
+        @"int64": @10000000000,
+        @"double": @1.5,
+        @"string": @"foo",
+        @"date": date,
+        @"data": [NSData dataWithBytes:"abc" length:3],
+        @"objectId": objectId,
+        @"decimal": [RLMDecimal128 decimalWithNumber:@2.5],
+        @"uuid": uuid,
+    }];
+
+    XCTAssertEqual([view indexOfKey:@"missing"], (NSUInteger)NSNotFound);
+    for (NSString *key in view.keys) {
+        XCTAssertEqualObjects([view keyAtIndex:[view indexOfKey:key]], key);
+    }
+    XCTAssertTrue([view boolAtIndex:[view indexOfKey:@"bool"]]);
+    XCTAssertEqual([view int64AtIndex:[view indexOfKey:@"int32"]], 5);
+    XCTAssertEqual([view int64AtIndex:[view indexOfKey:@"int64"]], 10000000000);
+    XCTAssertEqual([view doubleAtIndex:[view indexOfKey:@"double"]], 1.5);
+    XCTAssertEqualObjects([view stringAtIndex:[view indexOfKey:@"string"]], @"foo");
+    XCTAssertEqual([view timeIntervalSince1970AtIndex:[view indexOfKey:@"date"]], 500.25);
+    XCTAssertEqualObjects([view dataAtIndex:[view indexOfKey:@"data"]], [NSData dataWithBytes:"abc" length:3]);
+    XCTAssertEqualObjects([view objectIdAtIndex:[view indexOfKey:@"objectId"]], objectId);
+    XCTAssertEqualObjects([view decimal128AtIndex:[view indexOfKey:@"decimal"]], [RLMDecimal128 decimalWithNumber:@2.5]);
+    XCTAssertEqualObjects([view uuidAtIndex:[view indexOfKey:@"uuid"]], uuid);
+
+    XCTAssertThrows([view int64AtIndex:[view indexOfKey:@"string"]]);
+    XCTAssertThrows([view stringAtIndex:[view indexOfKey:@"int32"]]);
+    XCTAssertThrows([view boolAtIndex:view.count]);
+
+    // Type mismatches name the types involved
+    NSUInteger index = [view indexOfKey:@"int32"];
+    @try {
+        [view stringAtIndex:index];
+        XCTFail(@"should have thrown");
+    }
+    @catch (NSException *e) {
+        XCTAssertEqualObjects(e.reason, ([NSString stringWithFormat:@"BSON value at index %lu has type 'int32' rather than the expected type 'string'.",
+                                          (unsigned long)index]));
+    }
+}
+
 @end
@@ -24,6 +24,7 @@
 #import "RLMApp_Private.hpp"
 #import "RLMBSON_Private.hpp"
 #import "RLMCredentials.h"
+#import "RLMNetworkTransport_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMRealm+Sync.h"
 #import "RLMRealmConfiguration_Private.hpp"
@@ -42,6 +43,7 @@
 #import <realm/object-store/thread_safe_reference.hpp>
 #import <realm/util/file.hpp>
 
+#import <algorithm>
 #import <atomic>
 
 #pragma mark - Helpers
@@ -145,6 +147,87 @@ static NSString *generateRandomString(int num) {
     [self waitForExpectationsWithTimeout:30.0 handler:nil];
 }
 
+- (void)testNetworkTransportSessionConfiguration {
+    RLMNetworkTransport *transport = [RLMNetworkTransport new];
+    XCTAssertFalse(transport.sessionConfiguration.HTTPShouldUsePipelining);
+
+    NSURLSessionConfiguration *config = NSURLSessionConfiguration.ephemeralSessionConfiguration;
+    config.HTTPMaximumConnectionsPerHost = 2;
+    config.HTTPShouldUsePipelining = YES;
+    transport = [[RLMNetworkTransport alloc] initWithSessionConfiguration:config];
+    config.HTTPMaximumConnectionsPerHost = 3;
+    config.HTTPShouldUsePipelining = NO;
+    XCTAssertEqual(transport.sessionConfiguration.HTTPMaximumConnectionsPerHost, 2);
+    XCTAssertTrue(transport.sessionConfiguration.HTTPShouldUsePipelining);
+
+    // Requests should work with any session configuration
+    RLMRequest *request = [RLMRequest new];
+    request.method = RLMHTTPMethodGET;
+    request.url = [NSString stringWithFormat:@"http://localhost:9090/api/client/v2.0/app/%@/location", self.appId];
+    request.headers = @{};
+    request.timeout = 30;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"send request"];
+    [transport sendRequestToServer:request completion:^(RLMResponse *response) {
+        XCTAssertEqual(response.httpStatusCode, 200);
+        XCTAssertNotNil(response.bodyData);
+        XCTAssertTrue([response.body containsString:@"hostname"]);
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30.0 handler:nil];
+}
+
+- (void)testRequestAndResponseBodyData {
+    const uint8_t bytes[] = {'a', 0, 0xff, 'b'};
+    NSData *binary = [NSData dataWithBytes:bytes length:sizeof(bytes)];
+
+    RLMRequest *request = [RLMRequest new];
+    request.body = @"body";
+    XCTAssertEqualObjects(request.bodyData, [@"body" dataUsingEncoding:NSUTF8StringEncoding]);
+    request.bodyData = binary;
+    XCTAssertEqualObjects(request.bodyData, binary);
+    request.bodyData = [@"data" dataUsingEncoding:NSUTF8StringEncoding];
+    XCTAssertEqualObjects(request.body, @"data");
+
+    RLMResponse *response = [RLMResponse new];
+    response.bodyData = binary;
+    XCTAssertEqualObjects(response.bodyData, binary);
+    response.body = @"replaced";
+    XCTAssertEqualObjects(response.bodyData, [@"replaced" dataUsingEncoding:NSUTF8StringEncoding]);
+    response.bodyData = nil;
+    XCTAssertNil(response.body);
+}
+
+- (void)testSendAppRequestDirectly {
+    XCTAssertTrue(RLMTransportSupportsAppRequests([RLMNetworkTransport new]));
+    XCTAssertTrue(RLMTransportSupportsAppRequests([[RLMNetworkTransport alloc] initWithSessionConfiguration:NSURLSessionConfiguration.ephemeralSessionConfiguration]));
+    // Subclasses which override the request method have to go through it
+    XCTAssertFalse(RLMTransportSupportsAppRequests(self.app.configuration.transport));
+
+    RLMNetworkTransport *transport = [RLMNetworkTransport new];
+    realm::app::Request request{
+        .method = realm::app::HttpMethod::get,
+        .url = [NSString stringWithFormat:@"http://localhost:9090/api/client/v2.0/app/%@/location", self.appId].UTF8String,
+        .timeout_ms = 30000,
+    };
+    XCTestExpectation *expectation = [self expectationWithDescription:@"send request"];
+    [transport sendAppRequest:request completion:[&](const realm::app::Response& response) {
+        XCTAssertEqual(response.http_status_code, 200);
+        XCTAssertEqual(response.custom_status_code, 0);
+        XCTAssertNotEqual(response.body.find("hostname"), std::string::npos);
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30.0 handler:nil];
+
+    request.url = "http://localhost:1/location";
+    expectation = [self expectationWithDescription:@"send request to invalid host"];
+    [transport sendAppRequest:request completion:[&](const realm::app::Response& response) {
+        XCTAssertNotEqual(response.custom_status_code, 0);
+        XCTAssertFalse(response.body.empty());
+        [expectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:30.0 handler:nil];
+}
+
 - (void)testLogoutCurrentUser {
     RLMUser *user = self.anonymousUser;
     XCTestExpectation *expectation = [self expectationWithDescription:@"should log out current user"];
@@ -2118,4 +2201,59 @@ static NSString *oldPathForPartitionValue(RLMUser *user, NSString *oldName) {
 }
 @end
 
+#pragma mark - Performance
+
+@interface RLMObjectServerPerformanceTests : RLMSyncTestCase
+@end
+@implementation RLMObjectServerPerformanceTests
+
+// Call the `sum` function `count` times with at most `concurrency` requests in
+// flight at once, and log the throughput and p99 latency
+- (void)callFunctionsWithUser:(RLMUser *)user count:(NSUInteger)count concurrency:(NSUInteger)concurrency {
+    auto latencies = std::make_shared<std::vector<double>>(count);
+    dispatch_semaphore_t inFlight = dispatch_semaphore_create(concurrency);
+    dispatch_group_t group = dispatch_group_create();
+    CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+    for (NSUInteger i = 0; i < count; ++i) {
+        dispatch_semaphore_wait(inFlight, DISPATCH_TIME_FOREVER);
+        dispatch_group_enter(group);
+        CFAbsoluteTime requestStart = CFAbsoluteTimeGetCurrent();
+        [user callFunctionNamed:@"sum" arguments:@[@1, @2, @3]
+                completionBlock:^(id<RLMBSON> bson, NSError *error) {
+            (*latencies)[i] = CFAbsoluteTimeGetCurrent() - requestStart;
+            XCTAssertNil(error);
+            XCTAssertEqual([((NSNumber *)bson) intValue], 6);
+            dispatch_semaphore_signal(inFlight);
+            dispatch_group_leave(group);
+        }];
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    CFAbsoluteTime elapsed = CFAbsoluteTimeGetCurrent() - start;
+
+    std::sort(latencies->begin(), latencies->end());
+    double p99 = (*latencies)[count * 99 / 100];
+    NSLog(@"callFunctionNamed: with %lu concurrent requests: %.1f requests/sec, p99 latency %.1fms",
+          (unsigned long)concurrency, count / elapsed, p99 * 1000);
+}
+
+- (void)measureCallFunctionWithConcurrency:(NSUInteger)concurrency {
+    RLMUser *user = self.anonymousUser;
+    // Warm up the connection before measuring
+    [self callFunctionsWithUser:user count:10 concurrency:1];
+    [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
+        [self startMeasuring];
+        [self callFunctionsWithUser:user count:500 concurrency:concurrency];
+        [self stopMeasuring];
+    }];
+}
+
+- (void)testCallFunctionSerially {
+    [self measureCallFunctionWithConcurrency:1];
+}
+
+- (void)testCallFunctionConcurrently {
+    [self measureCallFunctionWithConcurrency:16];
+}
+@end
+
 #endif // TARGET_OS_OSX
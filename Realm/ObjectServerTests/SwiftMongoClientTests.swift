@@ -1225,6 +1225,171 @@ class AsyncAwaitMongoClientTests: SwiftSyncTestCase {
         XCTAssertEqual(documents.count, 1)
     }
 
+    struct DecodedDog: Decodable {
+        struct Owner: Decodable {
+            let name: String
+            let visits: [Int]
+        }
+        let _id: ObjectId
+        let name: String
+        let breed: String?
+        let age: Int8?
+        let weight: Double?
+        let birthday: Date?
+        let owner: Owner?
+    }
+
+    func testMongoCollectionFindDecodableCompletion() {
+        let collection = setupMongoCollection()
+        let birthday = Date(timeIntervalSince1970: 1_600_000_000.25)
+        let document: Document = ["name": "tomas", "breed": "jack rusell", "age": 3,
+                                  "birthday": .datetime(birthday),
+                                  "owner": ["name": "ana", "visits": [1, 2, 3]]]
+        let document1: Document = ["name": "lucas"]
+
+        let insertManyEx = expectation(description: "Insert many documents")
+        collection.insertMany([document, document1]) { result in
+            if case .failure = result {
+                XCTFail("Should insert")
+            }
+            insertManyEx.fulfill()
+        }
+        wait(for: [insertManyEx], timeout: 20.0)
+
+        let findEx = expectation(description: "Find documents")
+        collection.find(filter: [:], options: FindOptions(0, nil, [["name": -1]]), as: DecodedDog.self) { result in
+            switch result {
+            case .success(let dogs):
+                XCTAssertEqual(dogs.map(\.name), ["tomas", "lucas"])
+                XCTAssertEqual(dogs[0].age, 3)
+                XCTAssertEqual(dogs[0].birthday, birthday)
+                XCTAssertEqual(dogs[0].owner?.visits, [1, 2, 3])
+                XCTAssertNil(dogs[1].owner)
+            case .failure(let error):
+                XCTFail("Should find: \(error)")
+            }
+            findEx.fulfill()
+        }
+        wait(for: [findEx], timeout: 20.0)
+
+        struct WrongType: Decodable {
+            let name: Int
+        }
+        let findEx2 = expectation(description: "Find documents with the wrong type")
+        collection.find(filter: [:], as: WrongType.self) { result in
+            switch result {
+            case .success:
+                XCTFail("Decoding a string as an integer should have failed")
+            case .failure(let error):
+                guard case DecodingError.typeMismatch = error else {
+                    return XCTFail("Unexpected error \(error)")
+                }
+            }
+            findEx2.fulfill()
+        }
+        wait(for: [findEx2], timeout: 20.0)
+    }
+
+    func testMongoCollectionAggregateDecodableCompletion() {
+        let collection = setupMongoCollection()
+        let insertManyEx = expectation(description: "Insert many documents")
+        collection.insertMany([["name": "tomas", "breed": "jack rusell"],
+                               ["name": "lucas", "breed": "jack rusell"],
+                               ["name": "fito", "breed": "goberian"]]) { result in
+            if case .failure = result {
+                XCTFail("Should insert")
+            }
+            insertManyEx.fulfill()
+        }
+        wait(for: [insertManyEx], timeout: 20.0)
+
+        struct BreedCount: Decodable {
+            let _id: String
+            let count: Int
+        }
+        let aggregateEx = expectation(description: "Aggregate documents")
+        collection.aggregate(pipeline: [["$group": ["_id": "$breed", "count": ["$sum": 1]]],
+                                        ["$sort": ["_id": 1]]],
+                             as: BreedCount.self) { result in
+            switch result {
+            case .success(let counts):
+                XCTAssertEqual(counts.map(\._id), ["goberian", "jack rusell"])
+                XCTAssertEqual(counts.map(\.count), [1, 2])
+            case .failure(let error):
+                XCTFail("Should aggregate: \(error)")
+            }
+            aggregateEx.fulfill()
+        }
+        wait(for: [aggregateEx], timeout: 20.0)
+    }
+
+    func testMongoCollectionFindDecodableAsyncAwait() async throws {
+        let collection = try await setupMongoCollection()
+
+        let birthday = Date(timeIntervalSince1970: 1_600_000_000.25)
+        let document: Document = ["name": "tomas", "breed": "jack rusell", "age": 3,
+                                  "weight": 7, "birthday": .datetime(birthday),
+                                  "owner": ["name": "ana", "visits": [1, 2, 3]],
+                                  "unused": ["not": ["decoded"]]]
+        let document1: Document = ["name": "lucas"]
+        _ = try await collection.insertMany([document, document1])
+
+        let dogs = try await collection.find(filter: [:], as: DecodedDog.self)
+        XCTAssertEqual(dogs.count, 2)
+        XCTAssertEqual(dogs[0].name, "tomas")
+        XCTAssertEqual(dogs[0].breed, "jack rusell")
+        XCTAssertEqual(dogs[0].age, 3)
+        XCTAssertEqual(dogs[0].weight, 7)
+        XCTAssertEqual(dogs[0].birthday, birthday)
+        XCTAssertEqual(dogs[0].owner?.name, "ana")
+        XCTAssertEqual(dogs[0].owner?.visits, [1, 2, 3])
+        XCTAssertEqual(dogs[1].name, "lucas")
+        XCTAssertNil(dogs[1].breed)
+        XCTAssertNil(dogs[1].owner)
+        XCTAssertNotEqual(dogs[0]._id, dogs[1]._id)
+
+        let filtered = try await collection.find(filter: ["name": "lucas"], as: DecodedDog.self)
+        XCTAssertEqual(filtered.map(\.name), ["lucas"])
+
+        struct WrongType: Decodable {
+            let name: Int
+        }
+        do {
+            _ = try await collection.find(filter: [:], as: WrongType.self)
+            XCTFail("Decoding a string as an integer should have failed")
+        } catch DecodingError.typeMismatch(_, let context) {
+            XCTAssertEqual(context.codingPath.map(\.stringValue), ["0", "name"])
+        }
+
+        struct TooSmall: Decodable {
+            let age: UInt8
+            let name: String
+        }
+        _ = try await collection.insertOne(["name": "big", "age": 300])
+        do {
+            _ = try await collection.find(filter: ["name": "big"], as: TooSmall.self)
+            XCTFail("Decoding 300 as a UInt8 should have failed")
+        } catch DecodingError.dataCorrupted {
+        }
+    }
+
+    func testMongoCollectionAggregateDecodableAsyncAwait() async throws {
+        let collection = try await setupMongoCollection()
+        _ = try await collection.insertMany([["name": "tomas", "breed": "jack rusell"],
+                                             ["name": "lucas", "breed": "jack rusell"],
+                                             ["name": "fito", "breed": "goberian"]])
+
+        struct BreedCount: Decodable {
+            let _id: String
+            let count: Int
+        }
+        let counts = try await collection.aggregate(pipeline: [["$group": ["_id": "$breed", "count": ["$sum": 1]]],
+                                                               ["$sort": ["_id": 1]]],
+                                                    as: BreedCount.self)
+        XCTAssertEqual(counts.map(\._id), ["goberian", "jack rusell"])
+        XCTAssertEqual(counts.map(\.count), [1, 2])
+    }
+
     func testMongoCollectionCountAsyncAwait() async throws {
         let collection = try await setupMongoCollection()
 
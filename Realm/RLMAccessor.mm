@@ -108,6 +108,20 @@ id getBoxed(__unsafe_unretained RLMObjectBase *const obj, NSUInteger index) {
     return isNull(value) ? nil : ctx.box(std::move(value));
 }
 
+NSString *getString(__unsafe_unretained RLMObjectBase *const obj, NSUInteger index) {
+    RLMVerifyAttached(obj);
+    auto value = obj->_row.get<realm::StringData>(getProperty(obj, index).column_key);
+    if (value.is_null()) {
+        return nil;
+    }
+    // Frozen objects can be read from multiple threads at once, so they
+    // don't use the (unsynchronized) interned string cache
+    if (auto cache = obj->_info->internedStrings(index); cache && !obj->_realm->_realm->is_frozen()) {
+        return cache->get(value);
+    }
+    return RLMStringDataToNSString(value);
+}
+
 template<typename T>
 T getOptional(__unsafe_unretained RLMObjectBase *const obj, uint16_t key, bool *gotValue) {
     auto ret = get<std::optional<T>>(obj, key);
@@ -355,7 +369,9 @@ id managedGetter(RLMProperty *prop, const char *type) {
         case RLMPropertyTypeBool:
             return makeNumberGetter<bool>(index, boxed, prop.optional);
         case RLMPropertyTypeString:
-            return makeBoxedGetter<realm::StringData>(index);
+            return ^(__unsafe_unretained RLMObjectBase *const obj) {
+                return getString(obj, index);
+            };
         case RLMPropertyTypeDate:
             return makeBoxedGetter<realm::Timestamp>(index);
         case RLMPropertyTypeData:
@@ -753,7 +769,7 @@ REALM_FOR_EACH_SWIFT_OBJECT_TYPE(REALM_SWIFT_PROPERTY_ACCESSOR)
 #undef REALM_SWIFT_PROPERTY_ACCESSOR
 
 NSString *RLMGetSwiftPropertyString(__unsafe_unretained RLMObjectBase *const obj, uint16_t key) {
-    return getBoxed<realm::StringData>(obj, key);
+    return getString(obj, key);
 }
 
 NSData *RLMGetSwiftPropertyData(__unsafe_unretained RLMObjectBase *const obj, uint16_t key) {
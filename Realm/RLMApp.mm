@@ -31,6 +31,7 @@
 #import "RLMCredentials_Private.hpp"
 #import "RLMEmailPasswordAuth.h"
 #import "RLMLogger.h"
+#import "RLMNetworkTransport_Private.hpp"
 #import "RLMProviderClient_Private.hpp"
 #import "RLMPushClient_Private.hpp"
 #import "RLMSyncManager_Private.hpp"
@@ -52,14 +53,23 @@ namespace {
     /// Internal transport struct to bridge RLMNetworkingTransporting to the GenericNetworkTransport.
     class CocoaNetworkTransport : public realm::app::GenericNetworkTransport {
     public:
-        CocoaNetworkTransport(id<RLMNetworkTransport> transport) : m_transport(transport) {}
+        CocoaNetworkTransport(id<RLMNetworkTransport> transport)
+        : m_transport(transport)
+        , m_sends_app_requests(RLMTransportSupportsAppRequests(transport)) {}
 
         void send_request_to_server(const app::Request& request,
                                     util::UniqueFunction<void(const app::Response&)>&& completion) override {
+            // The built-in transport can send the request and receive the
+            // response body as bytes without going through Foundation types
+            if (m_sends_app_requests) {
+                return [static_cast<RLMNetworkTransport *>(m_transport) sendAppRequest:request
+                                                                           completion:std::move(completion)];
+            }
+
             // Convert the app::Request to an RLMRequest
             auto rlmRequest = [RLMRequest new];
             rlmRequest.url = @(request.url.data());
-            rlmRequest.body = @(request.body.data());
+            rlmRequest.bodyData = [NSData dataWithBytes:request.body.data() length:request.body.size()];
             NSMutableDictionary *headers = [NSMutableDictionary new];
             for (auto&& header : request.headers) {
                 headers[@(header.first.data())] = @(header.second.data());
@@ -78,12 +88,19 @@ namespace {
                 }];
 
                 // Convert the RLMResponse to an app:Response and pass downstream to
-                // the object store
+                // the object store. The body is copied as bytes, so it only
+                // has to be encoded if the transport set it as a string.
+                NSData *data = response.bodyData;
+                std::string body;
+                body.reserve(data.length);
+                [data enumerateByteRangesUsingBlock:[&](const void *bytes, NSRange range, BOOL *) {
+                    body.append(static_cast<const char *>(bytes), range.length);
+                }];
                 completion(app::Response{
                     .http_status_code = static_cast<int>(response.httpStatusCode),
                     .custom_status_code = static_cast<int>(response.customStatusCode),
                     .headers = bridgingHeaders,
-                    .body = response.body ? response.body.UTF8String : ""
+                    .body = std::move(body)
                 });
             }];
         }
@@ -93,6 +110,7 @@ namespace {
         }
     private:
         id<RLMNetworkTransport> m_transport;
+        bool m_sends_app_requests;
     };
 }
 
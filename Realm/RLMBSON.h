@@ -172,3 +172,151 @@ RLM_SWIFT_SENDABLE RLM_FINAL
 /// :nodoc:
 @interface NSUUID (RLMBSON)<RLMBSON>
 @end
+
+#pragma mark RLMBSONDocumentView
+
+RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
+
+@class RLMBSONArrayView, RLMBSONDocumentView;
+
+/**
+ Index-based access to the values of a BSON document or array view.
+
+ The typed accessors read scalar values directly from the BSON without
+ creating an intermediate `NSNumber` or `NSDate`, and throw an exception if the
+ value at the index is not of the expected type, so check `typeAtIndex:`
+ first. Indices must be less than `count`.
+ */
+@protocol RLMBSONIndexedValues <NSObject>
+
+/// The number of values.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// The BSON type of the value at the given index.
+- (RLMBSONType)typeAtIndex:(NSUInteger)index;
+
+/// The value at the given index. Documents and arrays are fully converted to
+/// `NSDictionary` and `NSArray`; use `documentAtIndex:` and `arrayAtIndex:` to
+/// read them lazily.
+- (id<RLMBSON>)objectAtIndex:(NSUInteger)index;
+
+/// A view of the value at the given index, or `nil` if it is not a document.
+- (nullable RLMBSONDocumentView *)documentAtIndex:(NSUInteger)index;
+
+/// A view of the value at the given index, or `nil` if it is not an array.
+- (nullable RLMBSONArrayView *)arrayAtIndex:(NSUInteger)index;
+
+/// The value at the given index, which must be a BSON bool.
+- (BOOL)boolAtIndex:(NSUInteger)index;
+
+/// The value at the given index, which must be a BSON int32 or int64.
+- (int64_t)int64AtIndex:(NSUInteger)index;
+
+/// The value at the given index, which must be a BSON double.
+- (double)doubleAtIndex:(NSUInteger)index;
+
+/// The value at the given index, which must be a BSON string.
+- (NSString *)stringAtIndex:(NSUInteger)index;
+
+/// The value at the given index as a number of seconds since 1970, which must
+/// be a BSON datetime or timestamp.
+- (NSTimeInterval)timeIntervalSince1970AtIndex:(NSUInteger)index;
+
+/// The value at the given index, which must be BSON binary data.
+- (NSData *)dataAtIndex:(NSUInteger)index;
+
+/// The value at the given index, which must be a BSON ObjectId.
+- (RLMObjectId *)objectIdAtIndex:(NSUInteger)index;
+
+/// The value at the given index, which must be a BSON decimal128.
+- (RLMDecimal128 *)decimal128AtIndex:(NSUInteger)index;
+
+/// The value at the given index, which must be a BSON UUID.
+- (NSUUID *)uuidAtIndex:(NSUInteger)index;
+
+@end
+
+/**
+ A read-only view of a BSON document which converts each value to its
+ Objective-C representation only when that value is read.
+
+ Reading a single field of a large document through a view does not require
+ converting the rest of the document, and nested documents and arrays can be
+ read as further views rather than being converted in their entirety.
+
+ Views are immutable and can be read from any thread.
+ */
+RLM_SWIFT_SENDABLE RLM_FINAL // immutable
+@interface RLMBSONDocumentView : NSObject <RLMBSONIndexedValues>
+
+/// The number of fields in the document.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// The names of the fields in the document, in the order they appear in it.
+@property (nonatomic, readonly) NSArray<NSString *> *keys;
+
+/// The index of the field with the given name, or `NSNotFound` if there is no
+/// such field. Looking up a field once and then reading it by index avoids
+/// searching the document for each read.
+- (NSUInteger)indexOfKey:(NSString *)key;
+
+/// The name of the field at the given index.
+- (NSString *)keyAtIndex:(NSUInteger)index;
+
+/// Whether the document has a field with the given name.
+- (BOOL)containsKey:(NSString *)key;
+
+/// The BSON type of the field with the given name, or `RLMBSONTypeNull` if
+/// there is no such field.
+- (RLMBSONType)typeForKey:(NSString *)key;
+
+/// The value of the field with the given name, or `nil` if there is no such
+/// field. Documents and arrays are fully converted to `NSDictionary` and
+/// `NSArray`; use `documentForKey:` and `arrayForKey:` to read them lazily.
+- (nullable id<RLMBSON>)objectForKeyedSubscript:(NSString *)key;
+
+/// A view of the field with the given name, or `nil` if there is no such
+/// field or it is not a document.
+- (nullable RLMBSONDocumentView *)documentForKey:(NSString *)key;
+
+/// A view of the field with the given name, or `nil` if there is no such
+/// field or it is not an array.
+- (nullable RLMBSONArrayView *)arrayForKey:(NSString *)key;
+
+/// The entire document converted to a dictionary.
+@property (nonatomic, readonly) NSDictionary<NSString *, id<RLMBSON>> *dictionaryValue;
+
+/// Creates a view of a copy of the given document.
+- (instancetype)initWithDictionary:(NSDictionary<NSString *, id<RLMBSON>> *)dictionary;
+
+/// :nodoc:
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/**
+ A read-only view of a BSON array which converts each value to its
+ Objective-C representation only when that value is read.
+
+ Views are immutable and can be read from any thread.
+ */
+RLM_SWIFT_SENDABLE RLM_FINAL // immutable
+@interface RLMBSONArrayView : NSObject <RLMBSONIndexedValues>
+
+/// The number of values in the array.
+@property (nonatomic, readonly) NSUInteger count;
+
+/// The value at the given index. Documents and arrays are fully converted to
+/// `NSDictionary` and `NSArray`; use `documentAtIndex:` and `arrayAtIndex:` to
+/// read them lazily.
+- (id<RLMBSON>)objectAtIndexedSubscript:(NSUInteger)index;
+
+/// The entire array converted to an array.
+@property (nonatomic, readonly) NSArray<id<RLMBSON>> *arrayValue;
+
+/// :nodoc:
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+RLM_HEADER_AUDIT_END(nullability, sendability)
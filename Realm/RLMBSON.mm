@@ -25,9 +25,20 @@
 
 #import <realm/util/bson/bson.hpp>
 
+#import <mutex>
+#import <string_view>
+#import <unordered_map>
+#import <vector>
+
 using namespace realm;
 using namespace bson;
 
+// Unlike RLMStringViewToNSString(), this returns an empty string rather than
+// nil for empty strings
+static NSString *bsonStringToNSString(std::string_view str) {
+    return [[NSString alloc] initWithBytes:str.data() length:str.size() encoding:NSUTF8StringEncoding];
+}
+
 #pragma mark NSNull
 
 @implementation NSNull (RLMBSON)
@@ -103,9 +114,8 @@ using namespace bson;
     return RLMBSONTypeArray;
 }
 
-- (instancetype)initWithBsonArray:(BsonArray)bsonArray {
-
-    if ((self = [self init])) {
+- (instancetype)initWithBsonArray:(const BsonArray&)bsonArray {
+    if ((self = [self initWithCapacity:bsonArray.size()])) {
         for (auto& entry : bsonArray) {
             [self addObject:RLMConvertBsonToRLMBSON(entry)];
         }
@@ -150,11 +160,11 @@ using namespace bson;
     return bsonDocument;
 }
 
-- (instancetype)initWithBsonDocument:(BsonDocument)bsonDocument {
-    if ((self = [self init])) {
+- (instancetype)initWithBsonDocument:(const BsonDocument&)bsonDocument {
+    if ((self = [self initWithCapacity:bsonDocument.size()])) {
         for (auto it = bsonDocument.begin(); it != bsonDocument.end(); ++it) {
             const auto& entry = (*it);
-            [self setObject:RLMConvertBsonToRLMBSON(entry.second) forKey:@(entry.first.data())];
+            [self setObject:RLMConvertBsonToRLMBSON(entry.second) forKey:bsonStringToNSString(entry.first)];
         }
 
         return self;
@@ -189,7 +199,7 @@ using namespace bson;
     return RLMBSONTypeBinary;
 }
 
-- (instancetype)initWithBsonBinary:(std::vector<char>)bsonBinary {
+- (instancetype)initWithBsonBinary:(const std::vector<char>&)bsonBinary {
     if ((self = [NSData dataWithBytes:bsonBinary.data() length:bsonBinary.size()])) {
         return self;
     }
@@ -380,13 +390,13 @@ id<RLMBSON> RLMConvertBsonToRLMBSON(const Bson& b) {
         case realm::bson::Bson::Type::Double:
             return @(static_cast<double>(b));
         case realm::bson::Bson::Type::String:
-            return @(static_cast<std::string>(b).c_str());
+            return bsonStringToNSString(static_cast<const std::string&>(b));
         case realm::bson::Bson::Type::Binary:
-            return [[NSData alloc] initWithBsonBinary:static_cast<std::vector<char>>(b)];
+            return [[NSData alloc] initWithBsonBinary:static_cast<const std::vector<char>&>(b)];
         case realm::bson::Bson::Type::Timestamp:
             return [[NSDate alloc] initWithTimeIntervalSince1970:static_cast<MongoTimestamp>(b).seconds];
         case realm::bson::Bson::Type::Datetime:
-            return [[NSDate alloc] initWithTimeIntervalSince1970:static_cast<Timestamp>(b).get_seconds()];
+            return RLMTimestampToNSDate(static_cast<Timestamp>(b));
         case realm::bson::Bson::Type::ObjectId:
             return [[RLMObjectId alloc] initWithValue:static_cast<ObjectId>(b)];
         case realm::bson::Bson::Type::Decimal128:
@@ -398,15 +408,23 @@ id<RLMBSON> RLMConvertBsonToRLMBSON(const Bson& b) {
         case realm::bson::Bson::Type::MinKey:
             return [RLMMinKey new];
         case realm::bson::Bson::Type::Document:
-            return [[NSMutableDictionary alloc] initWithBsonDocument:static_cast<BsonDocument>(b)];
+            return RLMConvertBsonToRLMBSON(static_cast<const BsonDocument&>(b));
         case realm::bson::Bson::Type::Array:
-            return [[NSMutableArray alloc] initWithBsonArray:static_cast<BsonArray>(b)];
+            return RLMConvertBsonToRLMBSON(static_cast<const BsonArray&>(b));
         case realm::bson::Bson::Type::Uuid:
             return [[NSUUID alloc] initWithRealmUUID:static_cast<realm::UUID>(b)];
     }
     return nil;
 }
 
+NSDictionary<NSString *, id<RLMBSON>> *RLMConvertBsonToRLMBSON(const BsonDocument& b) {
+    return [[NSMutableDictionary alloc] initWithBsonDocument:b];
+}
+
+NSArray<id<RLMBSON>> *RLMConvertBsonToRLMBSON(const BsonArray& b) {
+    return [[NSMutableArray alloc] initWithBsonArray:b];
+}
+
 id<RLMBSON> RLMConvertBsonDocumentToRLMBSON(std::optional<BsonDocument> b) {
     return b ? RLMConvertBsonToRLMBSON(*b) : nil;
 }
@@ -417,7 +435,332 @@ NSArray<id<RLMBSON>> *RLMConvertBsonDocumentToRLMBSONArray(std::optional<BsonDoc
     }
     NSMutableArray<id<RLMBSON>> *array = [[NSMutableArray alloc] init];
     for (const auto& [key, value] : *b) {
-        [array addObject:@{@(key.c_str()): RLMConvertBsonToRLMBSON(value)}];
+        [array addObject:@{bsonStringToNSString(key): RLMConvertBsonToRLMBSON(value)}];
     }
     return array;
 }
+
+#pragma mark RLMBSONDocumentView
+
+static RLMBSONType bsonTypeOf(const Bson& b) {
+    switch (b.type()) {
+        case Bson::Type::Null:              return RLMBSONTypeNull;
+        case Bson::Type::Int32:             return RLMBSONTypeInt32;
+        case Bson::Type::Int64:             return RLMBSONTypeInt64;
+        case Bson::Type::Bool:              return RLMBSONTypeBool;
+        case Bson::Type::Double:            return RLMBSONTypeDouble;
+        case Bson::Type::String:            return RLMBSONTypeString;
+        case Bson::Type::Binary:            return RLMBSONTypeBinary;
+        case Bson::Type::Timestamp:         return RLMBSONTypeTimestamp;
+        case Bson::Type::Datetime:          return RLMBSONTypeDatetime;
+        case Bson::Type::ObjectId:          return RLMBSONTypeObjectId;
+        case Bson::Type::Decimal128:        return RLMBSONTypeDecimal128;
+        case Bson::Type::RegularExpression: return RLMBSONTypeRegularExpression;
+        case Bson::Type::MaxKey:            return RLMBSONTypeMaxKey;
+        case Bson::Type::MinKey:            return RLMBSONTypeMinKey;
+        case Bson::Type::Document:          return RLMBSONTypeDocument;
+        case Bson::Type::Array:             return RLMBSONTypeArray;
+        case Bson::Type::Uuid:              return RLMBSONTypeUUID;
+    }
+    REALM_UNREACHABLE();
+}
+
+static NSString *bsonTypeName(RLMBSONType type) {
+    switch (type) {
+        case RLMBSONTypeNull:              return @"null";
+        case RLMBSONTypeInt32:             return @"int32";
+        case RLMBSONTypeInt64:             return @"int64";
+        case RLMBSONTypeBool:              return @"bool";
+        case RLMBSONTypeDouble:            return @"double";
+        case RLMBSONTypeString:            return @"string";
+        case RLMBSONTypeBinary:            return @"binary";
+        case RLMBSONTypeTimestamp:         return @"timestamp";
+        case RLMBSONTypeDatetime:          return @"datetime";
+        case RLMBSONTypeObjectId:          return @"objectId";
+        case RLMBSONTypeDecimal128:        return @"decimal128";
+        case RLMBSONTypeRegularExpression: return @"regularExpression";
+        case RLMBSONTypeMaxKey:            return @"maxKey";
+        case RLMBSONTypeMinKey:            return @"minKey";
+        case RLMBSONTypeDocument:          return @"document";
+        case RLMBSONTypeArray:             return @"array";
+        case RLMBSONTypeUUID:              return @"uuid";
+    }
+    REALM_UNREACHABLE();
+}
+
+static void throwOutOfBounds(NSUInteger index, size_t size) {
+    @throw RLMException(@"Index %llu is out of bounds (must be less than %llu).",
+                        (unsigned long long)index, (unsigned long long)size);
+}
+
+static const Bson& elementAt(const BsonArray& array, NSUInteger index) {
+    if (index >= array.size()) {
+        throwOutOfBounds(index, array.size());
+    }
+    return array[index];
+}
+
+// Read a scalar value for one of the typed accessors, which require the value
+// to have the expected type rather than converting it
+static const Bson& checkType(const Bson& value, NSUInteger index, RLMBSONType expected) {
+    if (bsonTypeOf(value) != expected) {
+        @throw RLMException(@"BSON value at index %llu has type '%@' rather than the expected type '%@'.",
+                            (unsigned long long)index, bsonTypeName(bsonTypeOf(value)), bsonTypeName(expected));
+    }
+    return value;
+}
+
+static int64_t bsonInt64(const Bson& value, NSUInteger index) {
+    if (value.type() == Bson::Type::Int32) {
+        return static_cast<int32_t>(value);
+    }
+    return static_cast<int64_t>(checkType(value, index, RLMBSONTypeInt64));
+}
+
+static NSTimeInterval bsonTimeInterval(const Bson& value, NSUInteger index) {
+    if (value.type() == Bson::Type::Timestamp) {
+        return static_cast<MongoTimestamp>(value).seconds;
+    }
+    auto ts = static_cast<Timestamp>(checkType(value, index, RLMBSONTypeDatetime));
+    return ts.get_seconds() + ts.get_nanoseconds() / 1'000'000'000.0;
+}
+
+// The typed accessors are identical for documents and arrays other than how
+// the value at an index is found
+#define RLM_BSON_INDEXED_ACCESSORS \
+- (BOOL)boolAtIndex:(NSUInteger)index { \
+    return static_cast<bool>(checkType([self valueAtIndex:index], index, RLMBSONTypeBool)); \
+} \
+- (int64_t)int64AtIndex:(NSUInteger)index { \
+    return bsonInt64([self valueAtIndex:index], index); \
+} \
+- (double)doubleAtIndex:(NSUInteger)index { \
+    return static_cast<double>(checkType([self valueAtIndex:index], index, RLMBSONTypeDouble)); \
+} \
+- (NSString *)stringAtIndex:(NSUInteger)index { \
+    auto& value = checkType([self valueAtIndex:index], index, RLMBSONTypeString); \
+    return bsonStringToNSString(static_cast<const std::string&>(value)); \
+} \
+- (NSTimeInterval)timeIntervalSince1970AtIndex:(NSUInteger)index { \
+    return bsonTimeInterval([self valueAtIndex:index], index); \
+} \
+- (NSData *)dataAtIndex:(NSUInteger)index { \
+    auto& value = checkType([self valueAtIndex:index], index, RLMBSONTypeBinary); \
+    return [[NSData alloc] initWithBsonBinary:static_cast<const std::vector<char>&>(value)]; \
+} \
+- (RLMObjectId *)objectIdAtIndex:(NSUInteger)index { \
+    auto& value = checkType([self valueAtIndex:index], index, RLMBSONTypeObjectId); \
+    return [[RLMObjectId alloc] initWithValue:static_cast<ObjectId>(value)]; \
+} \
+- (RLMDecimal128 *)decimal128AtIndex:(NSUInteger)index { \
+    auto& value = checkType([self valueAtIndex:index], index, RLMBSONTypeDecimal128); \
+    return [[RLMDecimal128 alloc] initWithDecimal128:static_cast<Decimal128>(value)]; \
+} \
+- (NSUUID *)uuidAtIndex:(NSUInteger)index { \
+    auto& value = checkType([self valueAtIndex:index], index, RLMBSONTypeUUID); \
+    return [[NSUUID alloc] initWithRealmUUID:static_cast<realm::UUID>(value)]; \
+}
+
+// Views of nested values share ownership of the root value which contains them
+template <typename T>
+static RLMBSONDocumentView *documentView(const std::shared_ptr<T>& owner, const Bson *value) {
+    if (!value || value->type() != Bson::Type::Document) {
+        return nil;
+    }
+    auto& document = static_cast<const BsonDocument&>(*value);
+    return [[RLMBSONDocumentView alloc] initWithDocument:std::shared_ptr<const BsonDocument>(owner, &document)];
+}
+
+template <typename T>
+static RLMBSONArrayView *arrayView(const std::shared_ptr<T>& owner, const Bson *value) {
+    if (!value || value->type() != Bson::Type::Array) {
+        return nil;
+    }
+    auto& array = static_cast<const BsonArray&>(*value);
+    return [[RLMBSONArrayView alloc] initWithArray:std::shared_ptr<const BsonArray>(owner, &array)];
+}
+
+@implementation RLMBSONDocumentView {
+    std::shared_ptr<const BsonDocument> _document;
+    // The fields in document order, and for larger documents an index from
+    // name to position, built on first use. Views may be read from multiple
+    // threads, so they are built under a once flag.
+    std::once_flag _indexOnce;
+    std::vector<std::pair<std::string_view, const Bson *>> _fields;
+    std::unordered_map<std::string_view, NSUInteger> _fieldIndex;
+}
+
+- (instancetype)initWithDocument:(std::shared_ptr<const BsonDocument>)document {
+    if (self = [super init]) {
+        _document = std::move(document);
+    }
+    return self;
+}
+
+- (instancetype)initWithDictionary:(NSDictionary<NSString *, id<RLMBSON>> *)dictionary {
+    auto document = static_cast<BsonDocument>(RLMConvertRLMBSONToBson(dictionary));
+    return [self initWithDocument:std::make_shared<const BsonDocument>(std::move(document))];
+}
+
+- (void)buildIndex {
+    std::call_once(_indexOnce, [&] {
+        _fields.reserve(_document->size());
+        for (auto& [k, v] : *_document) {
+            _fields.emplace_back(k, &v);
+        }
+        // Most documents returned from the server are small enough that a
+        // linear search is faster than hashing
+        if (_fields.size() > 16) {
+            _fieldIndex.reserve(_fields.size());
+            for (size_t i = 0; i < _fields.size(); ++i) {
+                // The first field with a given name is the one which is read
+                _fieldIndex.emplace(_fields[i].first, i);
+            }
+        }
+    });
+}
+
+- (const Bson&)valueAtIndex:(NSUInteger)index {
+    [self buildIndex];
+    if (index >= _fields.size()) {
+        throwOutOfBounds(index, _fields.size());
+    }
+    return *_fields[index].second;
+}
+
+- (NSUInteger)indexOfKey:(NSString *)key {
+    [self buildIndex];
+    std::string_view name = key.UTF8String;
+    if (!_fieldIndex.empty()) {
+        auto it = _fieldIndex.find(name);
+        return it == _fieldIndex.end() ? NSNotFound : it->second;
+    }
+    for (size_t i = 0; i < _fields.size(); ++i) {
+        if (_fields[i].first == name) {
+            return i;
+        }
+    }
+    return NSNotFound;
+}
+
+- (NSUInteger)count {
+    return _document->size();
+}
+
+- (NSArray<NSString *> *)keys {
+    NSMutableArray *keys = [[NSMutableArray alloc] initWithCapacity:_document->size()];
+    for (auto& [k, v] : *_document) {
+        [keys addObject:bsonStringToNSString(k)];
+    }
+    return keys;
+}
+
+- (NSString *)keyAtIndex:(NSUInteger)index {
+    [self valueAtIndex:index];
+    return bsonStringToNSString(_fields[index].first);
+}
+
+- (BOOL)containsKey:(NSString *)key {
+    return [self indexOfKey:key] != NSNotFound;
+}
+
+- (RLMBSONType)typeForKey:(NSString *)key {
+    NSUInteger index = [self indexOfKey:key];
+    return index == NSNotFound ? RLMBSONTypeNull : bsonTypeOf(*_fields[index].second);
+}
+
+- (id<RLMBSON>)objectForKeyedSubscript:(NSString *)key {
+    NSUInteger index = [self indexOfKey:key];
+    return index == NSNotFound ? nil : RLMConvertBsonToRLMBSON(*_fields[index].second);
+}
+
+- (RLMBSONDocumentView *)documentForKey:(NSString *)key {
+    NSUInteger index = [self indexOfKey:key];
+    return index == NSNotFound ? nil : documentView(_document, _fields[index].second);
+}
+
+- (RLMBSONArrayView *)arrayForKey:(NSString *)key {
+    NSUInteger index = [self indexOfKey:key];
+    return index == NSNotFound ? nil : arrayView(_document, _fields[index].second);
+}
+
+- (RLMBSONType)typeAtIndex:(NSUInteger)index {
+    return bsonTypeOf([self valueAtIndex:index]);
+}
+
+- (id<RLMBSON>)objectAtIndex:(NSUInteger)index {
+    return RLMConvertBsonToRLMBSON([self valueAtIndex:index]);
+}
+
+- (RLMBSONDocumentView *)documentAtIndex:(NSUInteger)index {
+    return documentView(_document, &[self valueAtIndex:index]);
+}
+
+- (RLMBSONArrayView *)arrayAtIndex:(NSUInteger)index {
+    return arrayView(_document, &[self valueAtIndex:index]);
+}
+
+RLM_BSON_INDEXED_ACCESSORS
+
+- (NSDictionary<NSString *, id<RLMBSON>> *)dictionaryValue {
+    return RLMConvertBsonToRLMBSON(*_document);
+}
+
+- (NSString *)description {
+    return self.dictionaryValue.description;
+}
+
+@end
+
+#pragma mark RLMBSONArrayView
+
+@implementation RLMBSONArrayView {
+    std::shared_ptr<const BsonArray> _array;
+}
+
+- (instancetype)initWithArray:(std::shared_ptr<const BsonArray>)array {
+    if (self = [super init]) {
+        _array = std::move(array);
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return _array->size();
+}
+
+- (RLMBSONType)typeAtIndex:(NSUInteger)index {
+    return bsonTypeOf(elementAt(*_array, index));
+}
+
+- (id<RLMBSON>)objectAtIndexedSubscript:(NSUInteger)index {
+    return RLMConvertBsonToRLMBSON(elementAt(*_array, index));
+}
+
+- (id<RLMBSON>)objectAtIndex:(NSUInteger)index {
+    return RLMConvertBsonToRLMBSON(elementAt(*_array, index));
+}
+
+- (RLMBSONDocumentView *)documentAtIndex:(NSUInteger)index {
+    return documentView(_array, &elementAt(*_array, index));
+}
+
+- (RLMBSONArrayView *)arrayAtIndex:(NSUInteger)index {
+    return arrayView(_array, &elementAt(*_array, index));
+}
+
+- (const Bson&)valueAtIndex:(NSUInteger)index {
+    return elementAt(*_array, index);
+}
+
+RLM_BSON_INDEXED_ACCESSORS
+
+- (NSArray<id<RLMBSON>> *)arrayValue {
+    return RLMConvertBsonToRLMBSON(*_array);
+}
+
+- (NSString *)description {
+    return self.arrayValue.description;
+}
+
+@end
@@ -17,15 +17,26 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #import <Realm/RLMBSON.h>
+#import <realm/util/bson/bson.hpp>
 #import <realm/util/optional.hpp>
 
-namespace realm::bson {
-class Bson;
-class BsonDocument;
-}
+#import <memory>
+
+@interface RLMBSONDocumentView ()
+// The view shares ownership of the document with whatever it was read from,
+// so views of nested documents should use the aliasing constructor of
+// shared_ptr to keep the root alive.
+- (instancetype)initWithDocument:(std::shared_ptr<const realm::bson::BsonDocument>)document;
+@end
+
+@interface RLMBSONArrayView ()
+- (instancetype)initWithArray:(std::shared_ptr<const realm::bson::BsonArray>)array;
+@end
 
 realm::bson::Bson RLMConvertRLMBSONToBson(id<RLMBSON> b);
 realm::bson::BsonDocument RLMConvertRLMBSONArrayToBsonDocument(NSArray<id<RLMBSON>> *array);
 id<RLMBSON> RLMConvertBsonToRLMBSON(const realm::bson::Bson& b);
+NSDictionary<NSString *, id<RLMBSON>> *RLMConvertBsonToRLMBSON(const realm::bson::BsonDocument& b);
+NSArray<id<RLMBSON>> *RLMConvertBsonToRLMBSON(const realm::bson::BsonArray& b);
 id<RLMBSON> RLMConvertBsonDocumentToRLMBSON(std::optional<realm::bson::BsonDocument> b);
 NSArray<id<RLMBSON>> *RLMConvertBsonDocumentToRLMBSONArray(std::optional<realm::bson::BsonDocument> b);
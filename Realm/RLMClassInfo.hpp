@@ -21,6 +21,8 @@
 #import <realm/table_ref.hpp>
 #import <realm/util/optional.hpp>
 
+#import <memory>
+#import <string>
 #import <unordered_map>
 #import <vector>
 
@@ -29,10 +31,14 @@ namespace realm {
     class Schema;
     struct Property;
     struct ColKey;
+    struct ObjKey;
     struct TableKey;
+    class StringData;
 }
 
+class RLMKeyPathCache;
 class RLMObservationInfo;
+class RLMQueryCache;
 @class RLMRealm, RLMSchema, RLMObjectSchema, RLMProperty;
 
 RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
@@ -51,6 +57,74 @@ template<> struct equal_to<NSString *> {
 };
 }
 
+// The observation info for each KVO-observed row of a single table. Only the
+// head of each row's linked list of RLMObservationInfo is stored. Iteration is
+// over a dense vector in insertion order (other than removals, which swap the
+// last element into the removed slot), and lookup by row is O(1) via a hash
+// index from object key to position in the vector.
+class RLMObservedObjects {
+    using storage = std::vector<RLMObservationInfo *>;
+
+public:
+    using const_iterator = storage::const_iterator;
+    using const_reverse_iterator = storage::const_reverse_iterator;
+
+    bool empty() const noexcept { return m_infos.empty(); }
+    size_t size() const noexcept { return m_infos.size(); }
+    RLMObservationInfo *front() const noexcept { return m_infos.front(); }
+
+    const_iterator begin() const noexcept { return m_infos.begin(); }
+    const_iterator end() const noexcept { return m_infos.end(); }
+    const_reverse_iterator rbegin() const noexcept { return m_infos.rbegin(); }
+    const_reverse_iterator rend() const noexcept { return m_infos.rend(); }
+
+    // Get the head of the list of observation info for the given row, or
+    // nullptr if the row is not observed. The infos for a deleted row are
+    // skipped, as its object key may have been reused by a new object.
+    RLMObservationInfo *_Nullable find(realm::ObjKey key) const noexcept;
+
+    // Add the given info as the head of the list for its row. The row must not
+    // already have an entry other than one for a deleted row, which is
+    // replaced. The infos in the replaced list keep their links to each other.
+    void insert(RLMObservationInfo *info);
+
+    // Replace the entry for `info`'s row with `replacement`, or remove it
+    // entirely if `replacement` is null. Does nothing if `info` is not the
+    // current head for its row. Returns whether the entry was changed.
+    bool replace(RLMObservationInfo *info, RLMObservationInfo *_Nullable replacement);
+
+    void clear() noexcept;
+
+private:
+    storage m_infos;
+    std::unordered_map<int64_t, size_t> m_index;
+};
+
+// A bounded cache of the NSStrings read from a single string property, so that
+// reading a value which has been read before returns the same NSString rather
+// than allocating a new one. Values are looked up by their contents using an
+// open-addressed hash table which never grows: once it holds `maxEntries`
+// values, values which aren't already present are boxed normally. Long strings
+// are never cached as they're unlikely to be repeated.
+class RLMInternedStringCache {
+public:
+    static constexpr size_t maxEntries = 256;
+    static constexpr size_t maxLength = 128;
+
+    // Get the NSString for the given non-null value
+    NSString *get(realm::StringData value);
+
+private:
+    struct Entry {
+        size_t hash;
+        std::string key;
+        NSString *_Nullable value;
+    };
+    // Allocated on first insertion with twice `maxEntries` slots
+    std::vector<Entry> m_entries;
+    size_t m_count = 0;
+};
+
 // The per-RLMRealm object schema information which stores the cached table
 // reference, handles table column lookups, and tracks observed objects
 class RLMClassInfo {
@@ -66,7 +140,11 @@ public:
 
     // Storage for the functionality in RLMObservation for handling indirect
     // changes to KVO-observed things
-    std::vector<RLMObservationInfo *> observedObjects;
+    RLMObservedObjects observedObjects;
+
+    // Compiled queries for predicates previously evaluated on this type,
+    // created on first use. Cleared when the Realm is invalidated.
+    std::shared_ptr<RLMQueryCache> queryCache;
 
     // Get the table for this object type. Will return nullptr only if it's a
     // read-only Realm that is missing the table entirely.
@@ -92,6 +170,12 @@ public:
     // getting the opposite table column of the origin's "forward" link.
     realm::ColKey computedTableColumn(RLMProperty *property) const;
 
+    // Get the interned string cache for the persisted property at the given
+    // index, or nullptr if the property is not interned.
+    RLMInternedStringCache *_Nullable internedStrings(size_t propertyIndex) const noexcept {
+        return propertyIndex < internedStringCaches.size() ? internedStringCaches[propertyIndex].get() : nullptr;
+    }
+
     // Get the info for the target of the link at the given property index.
     RLMClassInfo &linkTargetType(size_t propertyIndex);
 
@@ -111,10 +195,21 @@ public:
     // pairs to be used for deep change checking across links.
     // NEXT-MAJOR: This conflates a nil array and an empty array for backwards
     // compatibility, but core now gives them different semantics
+    // Resolved arrays are cached per type, and `RLMKeyPathFilter` instances
+    // skip rebuilding the cache key.
     std::optional<std::vector<std::vector<std::pair<realm::TableKey, realm::ColKey>>>>
     keyPathArrayFromStringArray(NSArray<NSString *> *keyPaths) const;
 
 private:
+    // Key path arrays previously resolved for this type, created on first use.
+    // Discarded along with the rest of the schema info when the schema changes.
+    mutable std::shared_ptr<RLMKeyPathCache> keyPathCache;
+
+    // Interned string caches indexed by persisted property index. Empty if
+    // there are no interned properties.
+    std::vector<std::unique_ptr<RLMInternedStringCache>> internedStringCaches;
+    void initializeInternedStringCaches();
+
     // If the ObjectSchema is not owned by the realm instance
     // we need to manually manage the ownership of the object.
     std::unique_ptr<realm::ObjectSchema> dynamicObjectSchema;
@@ -152,4 +247,8 @@ private:
     std::unordered_map<NSString *, RLMClassInfo> m_objects;
 };
 
+// Get the key under which the resolved form of the given notification key
+// paths is cached
+std::string RLMKeyPathCacheKey(NSArray<NSString *> *keyPaths);
+
 RLM_HEADER_AUDIT_END(nullability, sendability)
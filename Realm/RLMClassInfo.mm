@@ -19,6 +19,7 @@
 #import "RLMClassInfo.hpp"
 
 #import "RLMRealm_Private.hpp"
+#import "RLMObject_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMSchema.h"
 #import "RLMProperty_Private.h"
@@ -36,7 +37,9 @@ using namespace realm;
 RLMClassInfo::RLMClassInfo(__unsafe_unretained RLMRealm *const realm,
                            __unsafe_unretained RLMObjectSchema *const rlmObjectSchema,
                            const realm::ObjectSchema *objectSchema)
-: realm(realm), rlmObjectSchema(rlmObjectSchema), objectSchema(objectSchema) { }
+: realm(realm), rlmObjectSchema(rlmObjectSchema), objectSchema(objectSchema) {
+    initializeInternedStringCaches();
+}
 
 RLMClassInfo::RLMClassInfo(RLMRealm *realm, RLMObjectSchema *rlmObjectSchema,
                            std::unique_ptr<realm::ObjectSchema> schema)
@@ -45,7 +48,52 @@ RLMClassInfo::RLMClassInfo(RLMRealm *realm, RLMObjectSchema *rlmObjectSchema,
 , objectSchema(&*schema)
 , dynamicObjectSchema(std::move(schema))
 , dynamicRLMObjectSchema(rlmObjectSchema)
-{ }
+{
+    initializeInternedStringCaches();
+}
+
+void RLMClassInfo::initializeInternedStringCaches() {
+    NSArray<RLMProperty *> *properties = rlmObjectSchema.properties;
+    for (NSUInteger i = 0, count = properties.count; i < count; ++i) {
+        if (properties[i].interned) {
+            internedStringCaches.resize(count);
+            internedStringCaches[i] = std::make_unique<RLMInternedStringCache>();
+        }
+    }
+}
+
+NSString *RLMInternedStringCache::get(StringData value) {
+    if (value.size() > maxLength) {
+        return RLMStringDataToNSString(value);
+    }
+
+    std::string_view str(value.data(), value.size());
+    size_t hash = std::hash<std::string_view>()(str);
+    if (m_entries.empty()) {
+        m_entries.resize(maxEntries * 2);
+    }
+
+    // maxEntries is a power of two so the mask gives the slot index, and the
+    // table is never more than half full so probing always terminates
+    static_assert((maxEntries & (maxEntries - 1)) == 0);
+    size_t mask = m_entries.size() - 1;
+    for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+        Entry& entry = m_entries[i];
+        if (!entry.value) {
+            NSString *string = RLMStringDataToNSString(value);
+            if (m_count < maxEntries) {
+                entry.hash = hash;
+                entry.key = str;
+                entry.value = string;
+                ++m_count;
+            }
+            return string;
+        }
+        if (entry.hash == hash && entry.key == str) {
+            return entry.value;
+        }
+    }
+}
 
 realm::TableRef RLMClassInfo::table() const {
     if (auto key = objectSchema->table_key) {
@@ -144,15 +192,57 @@ static KeyPath keyPathFromString(RLMRealm *realm,
     return keyPairs;
 }
 
+class RLMKeyPathCache {
+public:
+    // Arbitrary limit to keep dynamically built key paths from growing the
+    // cache without bound; registrations normally use a few fixed filters
+    static constexpr size_t maxSize = 256;
+    std::unordered_map<std::string, KeyPathArray> arrays;
+};
+
+std::string RLMKeyPathCacheKey(NSArray<NSString *> *keyPaths) {
+    std::string key;
+    for (NSString *keyPath in keyPaths) {
+        key += keyPath.UTF8String;
+        key += '\0';
+    }
+    return key;
+}
+
 std::optional<realm::KeyPathArray> RLMClassInfo::keyPathArrayFromStringArray(NSArray<NSString *> *keyPaths) const {
     std::optional<KeyPathArray> keyPathArray;
-    if (keyPaths.count) {
-        keyPathArray.emplace();
-        for (NSString *keyPath in keyPaths) {
-            keyPathArray->push_back(keyPathFromString(realm, realm.schema, this,
-                                                      rlmObjectSchema, keyPath));
-        }
+    if (!keyPaths.count) {
+        return keyPathArray;
+    }
+
+    std::string computedKey;
+    std::string const* key;
+    if ([keyPaths isKindOfClass:[RLMKeyPathFilter class]]) {
+        key = &((RLMKeyPathFilter *)keyPaths)->_cacheKey;
+    }
+    else {
+        computedKey = RLMKeyPathCacheKey(keyPaths);
+        key = &computedKey;
+    }
+
+    if (!keyPathCache) {
+        keyPathCache = std::make_shared<RLMKeyPathCache>();
+    }
+    auto& arrays = keyPathCache->arrays;
+    if (auto it = arrays.find(*key); it != arrays.end()) {
+        keyPathArray = it->second;
+        return keyPathArray;
+    }
+
+    keyPathArray.emplace();
+    for (NSString *keyPath in keyPaths) {
+        keyPathArray->push_back(keyPathFromString(realm, realm.schema, this,
+                                                  rlmObjectSchema, keyPath));
+    }
+    if (arrays.size() >= RLMKeyPathCache::maxSize) {
+        arrays.clear();
     }
+    arrays.emplace(*key, *keyPathArray);
     return keyPathArray;
 }
 
@@ -33,8 +33,14 @@
 #import <realm/object-store/list.hpp>
 #import <realm/object-store/results.hpp>
 #import <realm/object-store/set.hpp>
+#import <realm/object-store/shared_realm.hpp>
+
+#import <vector>
 
 static const int RLMEnumerationBufferSize = 16;
+// The upper bound on the batch size used when reusing accessors. Batches start
+// at RLMEnumerationBufferSize and double each time until they reach this.
+static const NSUInteger RLMMaxReusedAccessorBatchSize = 1024;
 
 @implementation RLMFastEnumerator {
     // The buffer supplied by fast enumeration does not retain the objects given
@@ -43,6 +49,12 @@ static const int RLMEnumerationBufferSize = 16;
     // accessor objects) we need a thing to retain them.
     id _strongBuffer[RLMEnumerationBufferSize];
 
+    // When reusing accessors, the pool of accessor objects which are rebound to
+    // a new row for each batch rather than being recreated. This is used as
+    // the enumeration buffer in place of _strongBuffer.
+    std::vector<RLMObjectBase *> _accessorPool;
+    NSUInteger _batchSize;
+
     RLMRealm *_realm;
     RLMClassInfo *_info;
     RLMClassInfo *_parentInfo;
@@ -140,12 +152,66 @@ static const int RLMEnumerationBufferSize = 16;
     _collection = nil;
 }
 
+- (void)releaseResultsIfDone:(NSUInteger)batchCount {
+    if (batchCount == 0) {
+        // Release our data if we're done, as we're autoreleased and so may
+        // stick around for a while
+        if (_collection) {
+            _collection = nil;
+            [_realm unregisterEnumerator:self];
+        }
+
+        _snapshot = {};
+        _accessorPool.clear();
+    }
+}
+
+- (NSUInteger)countByEnumeratingReusingAccessors:(NSFastEnumerationState *)state {
+    NSUInteger count = state->extra[1];
+    NSUInteger batchCount = std::min<NSUInteger>(_batchSize, count - std::min<NSUInteger>(state->state, count));
+    if (_accessorPool.size() < batchCount) {
+        _accessorPool.resize(batchCount);
+    }
+
+    // Top-level Results need to report audit reads for the objects they
+    // produce, which RLMAccessorContext::box() normally does for us
+    bool audit = !_parentInfo && _realm->_realm->audit_context();
+    Class accessorClass = _info->rlmObjectSchema.accessorClass;
+    for (NSUInteger i = 0; i < batchCount; ++i) {
+        auto obj = _results->get(state->state + i);
+        if (audit) {
+            realm::Object(_realm->_realm, *_info->objectSchema, obj);
+        }
+
+        __strong RLMObjectBase *&accessor = _accessorPool[i];
+        // Observed accessors can't be rebound as the observation info is tied
+        // to the row, so replace them with a fresh one
+        if (!accessor || accessor->_observationInfo) {
+            accessor = RLMCreateManagedAccessor(accessorClass, _info);
+        }
+        accessor->_row = std::move(obj);
+        RLMInitializeSwiftAccessor(accessor, false);
+    }
+
+    [self releaseResultsIfDone:batchCount];
+
+    state->itemsPtr = (__unsafe_unretained id *)(void *)_accessorPool.data();
+    state->state += batchCount;
+    state->mutationsPtr = state->extra+1;
+
+    _batchSize = std::min(_batchSize * 2, RLMMaxReusedAccessorBatchSize);
+    return batchCount;
+}
+
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
                                     count:(NSUInteger)len {
     [_realm verifyThread];
     if (!_results->is_valid()) {
         @throw RLMException(@"Collection is no longer valid");
     }
+    if (_batchSize && _results->get_type() == realm::PropertyType::Object) {
+        return [self countByEnumeratingReusingAccessors:state];
+    }
     // The fast enumeration buffer size is currently a hardcoded number in the
     // compiler so this can't actually happen, but just in case it changes in
     // the future...
@@ -168,16 +234,7 @@ static const int RLMEnumerationBufferSize = 16;
         _strongBuffer[i] = nil;
     }
 
-    if (batchCount == 0) {
-        // Release our data if we're done, as we're autoreleased and so may
-        // stick around for a while
-        if (_collection) {
-            _collection = nil;
-            [_realm unregisterEnumerator:self];
-        }
-
-        _snapshot = {};
-    }
+    [self releaseResultsIfDone:batchCount];
 
     state->itemsPtr = (__unsafe_unretained id *)(void *)_strongBuffer;
     state->state += batchCount;
@@ -185,14 +242,22 @@ static const int RLMEnumerationBufferSize = 16;
 
     return batchCount;
 }
+
+- (void)reuseAccessors {
+    _batchSize = RLMEnumerationBufferSize;
+}
 @end
 
 NSUInteger RLMFastEnumerate(NSFastEnumerationState *state,
                             NSUInteger len,
-                            id<RLMCollectionPrivate> collection) {
+                            id<RLMCollectionPrivate> collection,
+                            bool reuseAccessors) {
     __autoreleasing RLMFastEnumerator *enumerator;
     if (state->state == 0) {
         enumerator = collection.fastEnumerator;
+        if (reuseAccessors) {
+            [enumerator reuseAccessors];
+        }
         state->extra[0] = (long)enumerator;
         state->extra[1] = collection.count;
     }
@@ -39,4 +39,40 @@ typedef RLM_CLOSED_ENUM(int32_t, RLMCollectionType) {
     RLMCollectionTypeDictionary = 2
 };
 
+// The instructions making up an RLMQueryExpression. Each node of the
+// expression is written in prefix order:
+//  - True: matches everything
+//  - And/Or: followed by two child nodes
+//  - Not: followed by one child node
+//  - Compare: followed by three words giving the NSPredicateOperatorType,
+//    NSComparisonPredicateOptions and NSComparisonPredicateModifier, and then
+//    two operands
+//  - KeyPath/Constant: an operand, followed by one word giving the index into
+//    the expression's keyPaths or values array
+typedef RLM_CLOSED_ENUM(uint32_t, RLMQueryInstruction) {
+    RLMQueryInstructionTrue,
+    RLMQueryInstructionAnd,
+    RLMQueryInstructionOr,
+    RLMQueryInstructionNot,
+    RLMQueryInstructionCompare,
+    RLMQueryInstructionKeyPath,
+    RLMQueryInstructionConstant,
+};
+
+// A predicate stored as a compact list of instructions, which is converted
+// directly to a query without going through NSPredicate's parser or
+// expression objects. Evaluating it on unmanaged objects or getting its format
+// string uses an equivalent NSPredicate built on demand.
+@interface RLMQueryExpression : NSPredicate
+- (instancetype)initWithInstructions:(NSData *)instructions
+                            keyPaths:(NSArray<NSString *> *)keyPaths
+                              values:(NSArray *)values
+                    predicateBuilder:(NSPredicate *(^)(void))predicateBuilder;
+
+@property (nonatomic, readonly) NSData *instructions;
+@property (nonatomic, readonly) NSArray<NSString *> *keyPaths;
+@property (nonatomic, readonly) NSArray *values;
+@property (nonatomic, readonly) NSPredicate *predicate;
+@end
+
 RLM_HEADER_AUDIT_END(nullability, sendability)
@@ -81,10 +81,18 @@ RLM_DIRECT_MEMBERS
 // source collection is changed.
 - (void)detach;
 
+// Reuse a pool of accessor objects across batches by rebinding them to the next
+// rows rather than creating a new accessor for each object, and grow the batch
+// size as enumeration progresses. Each object yielded is only valid until the
+// next batch is produced, so this can only be used when the caller does not
+// retain the enumerated objects. Has no effect on collections of non-objects.
+- (void)reuseAccessors;
+
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
                                     count:(NSUInteger)len;
 @end
-NSUInteger RLMFastEnumerate(NSFastEnumerationState *state, NSUInteger len, id<RLMCollectionPrivate> collection);
+NSUInteger RLMFastEnumerate(NSFastEnumerationState *state, NSUInteger len, id<RLMCollectionPrivate> collection,
+                            bool reuseAccessors=false);
 
 @interface RLMNotificationToken ()
 - (void)suppressNextNotification;
@@ -0,0 +1,32 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#import <Realm/RLMLogger.h>
+
+@class RLMDescriptionOptions, RLMResults;
+
+// Write a description of the results to the file descriptor, reading values
+// directly from the rows and writing them out incrementally rather than
+// building the full string in memory. Returns false and sets `error` if
+// writing to the file descriptor failed.
+bool RLMWriteResultsDescription(RLMResults *results, int fileDescriptor,
+                                RLMDescriptionOptions *options, NSError **error);
+
+// Log a description of the results, with one message per object in the results.
+void RLMLogResultsDescription(RLMResults *results, RLMLogger *logger, RLMLogLevel level,
+                              RLMDescriptionOptions *options);
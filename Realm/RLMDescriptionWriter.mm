@@ -0,0 +1,620 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#import "RLMDescriptionWriter.hpp"
+
+#import "RLMArray_Private.h"
+#import "RLMCollection_Private.hpp"
+#import "RLMLogger_Private.h"
+#import "RLMObjectBase_Private.h"
+#import "RLMObject_Private.h"
+#import "RLMObjectSchema_Private.hpp"
+#import "RLMProperty_Private.h"
+#import "RLMRealm_Private.hpp"
+#import "RLMResults_Private.hpp"
+#import "RLMUtil.hpp"
+
+#import <realm/dictionary.hpp>
+#import <realm/object-store/results.hpp>
+#import <realm/table.hpp>
+
+#import <algorithm>
+#import <cerrno>
+#import <cmath>
+#import <ctime>
+#import <functional>
+#import <string>
+#import <unistd.h>
+#import <unordered_map>
+#import <vector>
+
+using namespace realm;
+
+@implementation RLMDescriptionOptions {
+    NSUInteger _maxNestedObjects;
+    // JSON output is meant to be read back in, so nested collections are only
+    // truncated there if a limit was set explicitly
+    bool _hasMaxNestedObjects;
+}
+
+- (instancetype)init {
+    if ((self = [super init])) {
+        _maxDepth = RLMDescriptionMaxDepth;
+        _maxNestedObjects = 100;
+    }
+    return self;
+}
+
+- (NSUInteger)maxNestedObjects {
+    return _json && !_hasMaxNestedObjects ? 0 : _maxNestedObjects;
+}
+
+- (void)setMaxNestedObjects:(NSUInteger)maxNestedObjects {
+    _maxNestedObjects = maxNestedObjects;
+    _hasMaxNestedObjects = true;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    RLMDescriptionOptions *copy = [[RLMDescriptionOptions alloc] init];
+    copy.maxDepth = _maxDepth;
+    copy.maxObjects = _maxObjects;
+    copy->_maxNestedObjects = _maxNestedObjects;
+    copy->_hasMaxNestedObjects = _hasMaxNestedObjects;
+    copy.json = _json;
+    return copy;
+}
+@end
+
+namespace {
+// Thrown when the sink fails to write and reported to the caller as an NSError
+struct WriteError {
+    int code;
+};
+
+constexpr size_t maxPrintedDataLength = 24;
+
+// The per-class information needed to write an object, computed the first
+// time an object of that class is written rather than once per object.
+struct PropertyInfo {
+    RLMProperty *property;
+    ColKey column;
+    std::string name;
+    RLMClassInfo *target;
+};
+
+class DescriptionWriter {
+public:
+    // `flushThreshold` bounds how much output is buffered before being handed
+    // to the sink. The sink is also called at the end of each top-level object.
+    DescriptionWriter(RLMRealm *realm, RLMDescriptionOptions *options,
+                      std::function<void(std::string_view)> sink, size_t flushThreshold)
+    : m_realm(realm)
+    , m_sink(std::move(sink))
+    , m_flushThreshold(flushThreshold)
+    , m_maxDepth(options.maxDepth)
+    , m_maxObjects(options.maxObjects)
+    , m_maxNestedObjects(options.maxNestedObjects)
+    , m_json(options.json)
+    {
+        m_buffer.reserve(flushThreshold);
+    }
+
+    void write_results(RLMResults *results);
+
+private:
+    RLMRealm *m_realm;
+    std::function<void(std::string_view)> m_sink;
+    size_t m_flushThreshold;
+    NSUInteger m_maxDepth;
+    NSUInteger m_maxObjects;
+    NSUInteger m_maxNestedObjects;
+    bool m_json;
+
+    std::string m_buffer;
+    size_t m_indent = 0;
+    std::unordered_map<RLMClassInfo *, std::vector<PropertyInfo>> m_properties;
+
+    void write(std::string_view str) {
+        m_buffer.append(str);
+        if (m_buffer.size() >= m_flushThreshold) {
+            flush();
+        }
+    }
+    void write(char c) {
+        m_buffer.push_back(c);
+    }
+    void flush() {
+        if (!m_buffer.empty()) {
+            m_sink(m_buffer);
+            m_buffer.clear();
+        }
+    }
+
+    void newline() {
+        write('\n');
+        if (!m_json) {
+            m_buffer.append(m_indent, '\t');
+        }
+    }
+
+    void write_max_depth_exceeded() {
+        write(m_json ? "null" : "<Maximum depth exceeded>");
+    }
+
+    std::vector<PropertyInfo> const& properties(RLMClassInfo& info);
+    void write_object(RLMClassInfo& info, Obj const& obj, NSUInteger depth);
+    void write_value(Mixed const& value, RLMClassInfo *linkTarget, NSUInteger depth);
+    void write_property(PropertyInfo const& prop, RLMClassInfo& info, Obj const& obj, NSUInteger depth);
+    void write_string(StringData str);
+    void write_double(double value);
+    void write_timestamp(Timestamp ts);
+    void write_binary(BinaryData data);
+
+    template <typename Fn>
+    void write_sequence(std::string_view name, NSString *type, size_t size, NSUInteger depth, Fn&& writeElement);
+};
+
+std::vector<PropertyInfo> const& DescriptionWriter::properties(RLMClassInfo& info) {
+    auto& props = m_properties[&info];
+    if (props.empty()) {
+        for (RLMProperty *prop in info.rlmObjectSchema.properties) {
+            RLMClassInfo *target = nullptr;
+            if (prop.type == RLMPropertyTypeObject) {
+                target = &m_realm->_info[prop.objectClassName];
+            }
+            props.push_back({prop, info.tableColumn(prop), prop.name.UTF8String, target});
+        }
+    }
+    return props;
+}
+
+void DescriptionWriter::write_string(StringData str) {
+    if (!m_json) {
+        write(std::string_view(str.data(), str.size()));
+        return;
+    }
+    write('"');
+    for (char c : std::string_view(str.data(), str.size())) {
+        switch (c) {
+            case '"': write("\\\""); break;
+            case '\\': write("\\\\"); break;
+            case '\n': write("\\n"); break;
+            case '\r': write("\\r"); break;
+            case '\t': write("\\t"); break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    write(escaped);
+                }
+                else {
+                    write(c);
+                }
+        }
+    }
+    write('"');
+}
+
+void DescriptionWriter::write_double(double value) {
+    if (m_json && !std::isfinite(value)) {
+        write("null");
+        return;
+    }
+    // Use the shortest representation which round-trips
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.15g", value);
+    if (strtod(buffer, nullptr) != value) {
+        snprintf(buffer, sizeof(buffer), "%.17g", value);
+    }
+    write(buffer);
+}
+
+void DescriptionWriter::write_timestamp(Timestamp ts) {
+    // Round towards negative infinity so that dates before 1970 are correct
+    int64_t milliseconds = ts.get_seconds() * 1000 + ts.get_nanoseconds() / 1'000'000;
+    time_t seconds = static_cast<time_t>(milliseconds / 1000);
+    int millis = static_cast<int>(milliseconds % 1000);
+    if (millis < 0) {
+        millis += 1000;
+        --seconds;
+    }
+    struct tm tm;
+    gmtime_r(&seconds, &tm);
+
+    // Text output matches -[NSDate description], and JSON output matches the
+    // format read by the JSON importer
+    char buffer[64];
+    if (m_json) {
+        size_t len = strftime(buffer, sizeof(buffer), "\"%Y-%m-%dT%H:%M:%S", &tm);
+        snprintf(buffer + len, sizeof(buffer) - len, ".%03d+0000\"", millis);
+    }
+    else {
+        strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S +0000", &tm);
+    }
+    write(buffer);
+}
+
+void DescriptionWriter::write_binary(BinaryData data) {
+    auto bytes = reinterpret_cast<const unsigned char *>(data.data());
+    if (m_json) {
+        static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        write('"');
+        size_t i = 0;
+        for (; i + 2 < data.size(); i += 3) {
+            uint32_t n = bytes[i] << 16 | bytes[i + 1] << 8 | bytes[i + 2];
+            char chunk[4] = {alphabet[n >> 18], alphabet[(n >> 12) & 63], alphabet[(n >> 6) & 63], alphabet[n & 63]};
+            write(std::string_view(chunk, 4));
+        }
+        if (size_t remaining = data.size() - i) {
+            uint32_t n = bytes[i] << 16 | (remaining == 2 ? bytes[i + 1] << 8 : 0);
+            char chunk[4] = {alphabet[n >> 18], alphabet[(n >> 12) & 63],
+                             remaining == 2 ? alphabet[(n >> 6) & 63] : '=', '='};
+            write(std::string_view(chunk, 4));
+        }
+        write('"');
+        return;
+    }
+
+    write('<');
+    char hex[3];
+    for (size_t i = 0; i < std::min(data.size(), maxPrintedDataLength); ++i) {
+        snprintf(hex, sizeof(hex), "%02x", bytes[i]);
+        write(std::string_view(hex, 2));
+    }
+    write(" — ");
+    write(std::to_string(data.size()));
+    write(" total bytes>");
+}
+
+void DescriptionWriter::write_value(Mixed const& value, RLMClassInfo *linkTarget, NSUInteger depth) {
+    if (value.is_null()) {
+        write(m_json ? "null" : "(null)");
+        return;
+    }
+    switch (value.get_type()) {
+        case type_Int:
+            write(std::to_string(value.get_int()));
+            break;
+        case type_Bool:
+            if (m_json) {
+                write(value.get_bool() ? "true" : "false");
+            }
+            else {
+                write(value.get_bool() ? '1' : '0');
+            }
+            break;
+        case type_Float:
+            write_double(value.get_float());
+            break;
+        case type_Double:
+            write_double(value.get_double());
+            break;
+        case type_String:
+            write_string(value.get_string());
+            break;
+        case type_Binary:
+            write_binary(value.get_binary());
+            break;
+        case type_Timestamp:
+            write_timestamp(value.get_timestamp());
+            break;
+        case type_Decimal:
+        case type_ObjectId:
+        case type_UUID: {
+            std::string str = value.get_type() == type_Decimal ? value.get<Decimal128>().to_string()
+                            : value.get_type() == type_ObjectId ? value.get<ObjectId>().to_string()
+                            : value.get<UUID>().to_string();
+            write_string(str);
+            break;
+        }
+        case type_Link: {
+            auto table = linkTarget->table();
+            auto key = value.get<ObjKey>();
+            if (!table->is_valid(key)) {
+                write(m_json ? "null" : "(null)");
+            }
+            else {
+                write_object(*linkTarget, table->get_object(key), depth);
+            }
+            break;
+        }
+        case type_TypedLink: {
+            auto link = value.get<ObjLink>();
+            RLMClassInfo *info = m_realm->_info[link.get_table_key()];
+            if (!info || !info->table()->is_valid(link.get_obj_key())) {
+                write(m_json ? "null" : "(null)");
+            }
+            else {
+                write_object(*info, info->table()->get_object(link.get_obj_key()), depth);
+            }
+            break;
+        }
+        default:
+            // Collections nested in mixed properties are written by the caller
+            write(m_json ? "null" : "(null)");
+            break;
+    }
+}
+
+template <typename Fn>
+void DescriptionWriter::write_sequence(std::string_view name, NSString *type, size_t size,
+                                       NSUInteger depth, Fn&& writeElement) {
+    if (depth == 0) {
+        write_max_depth_exceeded();
+        return;
+    }
+
+    size_t count = m_maxNestedObjects ? std::min<size_t>(size, m_maxNestedObjects) : size;
+    if (m_json) {
+        write('[');
+        for (size_t i = 0; i < count; ++i) {
+            if (i) {
+                write(',');
+            }
+            writeElement(i, depth - 1);
+        }
+        write(']');
+        return;
+    }
+
+    write(name);
+    write('<');
+    write(type.UTF8String);
+    write("> (");
+    ++m_indent;
+    for (size_t i = 0; i < count; ++i) {
+        newline();
+        write('[');
+        write(std::to_string(i));
+        write("] ");
+        writeElement(i, depth - 1);
+        if (i + 1 < count) {
+            write(',');
+        }
+    }
+    if (count < size) {
+        newline();
+        write("... ");
+        write(std::to_string(size - count));
+        write(" objects skipped.");
+    }
+    --m_indent;
+    newline();
+    write(')');
+}
+
+void DescriptionWriter::write_property(PropertyInfo const& prop, RLMClassInfo& info,
+                                       Obj const& obj, NSUInteger depth) {
+    RLMProperty *property = prop.property;
+    NSString *type = property.objectClassName ?: RLMTypeToString(property.type);
+    if (property.dictionary) {
+        auto dictionary = obj.get_dictionary(prop.column);
+        size_t size = dictionary.size();
+        if (depth == 0) {
+            write_max_depth_exceeded();
+            return;
+        }
+        size_t count = m_maxNestedObjects ? std::min<size_t>(size, m_maxNestedObjects) : size;
+        if (m_json) {
+            write('{');
+        }
+        else {
+            write("RLMDictionary<string, ");
+            write(type.UTF8String);
+            write("> (");
+            ++m_indent;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            auto [key, value] = dictionary.get_pair(i);
+            if (m_json) {
+                if (i) {
+                    write(',');
+                }
+                write_string(key.get_string());
+                write(':');
+            }
+            else {
+                newline();
+                write('[');
+                write_string(key.get_string());
+                write("]: ");
+            }
+            write_value(value, prop.target, depth - 1);
+            if (!m_json && i + 1 < count) {
+                write(',');
+            }
+        }
+        if (m_json) {
+            write('}');
+            return;
+        }
+        if (count < size) {
+            newline();
+            write("... ");
+            write(std::to_string(size - count));
+            write(" objects skipped.");
+        }
+        --m_indent;
+        newline();
+        write(')');
+        return;
+    }
+
+    if (property.collection) {
+        auto collection = obj.get_collection_ptr(prop.column);
+        write_sequence(property.set ? "RLMSet" : "RLMArray", type, collection->size(), depth,
+                       [&](size_t i, NSUInteger depth) {
+            write_value(collection->get_any(i), prop.target, depth);
+        });
+        return;
+    }
+
+    Mixed value = obj.get_any(prop.column);
+    if (property.type == RLMPropertyTypeAny
+        && (value.is_type(type_List) || value.is_type(type_Dictionary))) {
+        // Nested collections in mixed properties are rare enough that they
+        // just use the normal accessor-based description
+        if (m_json) {
+            write("null");
+        }
+        else {
+            id collection = RLMMixedToObjc(value, m_realm, &info, property, obj);
+            NSString *description = [collection descriptionWithMaxDepth:depth];
+            std::string indent = "\n" + std::string(m_indent, '\t');
+            write([description stringByReplacingOccurrencesOfString:@"\n"
+                                                          withString:@(indent.c_str())].UTF8String);
+        }
+        return;
+    }
+    write_value(value, prop.target, depth);
+}
+
+void DescriptionWriter::write_object(RLMClassInfo& info, Obj const& obj, NSUInteger depth) {
+    if (depth == 0) {
+        write_max_depth_exceeded();
+        return;
+    }
+
+    auto& props = properties(info);
+    if (m_json) {
+        write('{');
+        bool first = true;
+        for (auto& prop : props) {
+            if (!first) {
+                write(',');
+            }
+            first = false;
+            write_string(prop.name);
+            write(':');
+            write_property(prop, info, obj, depth - 1);
+        }
+        write('}');
+        return;
+    }
+
+    write(info.rlmObjectSchema.className.UTF8String);
+    write(" {");
+    ++m_indent;
+    for (auto& prop : props) {
+        newline();
+        write(prop.name);
+        write(" = ");
+        write_property(prop, info, obj, depth - 1);
+        write(';');
+    }
+    --m_indent;
+    newline();
+    write('}');
+}
+
+void DescriptionWriter::write_results(RLMResults *results) {
+    Results& r = results->_results;
+    RLMClassInfo *info = results.objectInfo;
+    bool isObject = r.get_type() == PropertyType::Object;
+    size_t size = r.size();
+    size_t count = m_maxObjects ? std::min<size_t>(size, m_maxObjects) : size;
+
+    // Each top-level object is written as a complete line (or lines) and then
+    // handed to the sink, so only one object is ever buffered at a time
+    if (!m_json) {
+        NSString *type = results.objectClassName ?: RLMTypeToString(results.type);
+        write("RLMResults<");
+        write(type.UTF8String);
+        write("> (\n");
+        flush();
+        m_indent = 1;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (!m_json) {
+            write("\t[");
+            write(std::to_string(i));
+            write("] ");
+        }
+        // The results count as one level of nesting, as they do in `description`
+        if (m_maxDepth == 0) {
+            write_max_depth_exceeded();
+        }
+        else if (isObject) {
+            write_object(*info, r.get<Obj>(i), m_maxDepth - 1);
+        }
+        else {
+            write_value(r.get_any(i), nullptr, m_maxDepth - 1);
+        }
+        if (!m_json && i + 1 < count) {
+            write(',');
+        }
+        write('\n');
+        flush();
+    }
+    if (!m_json) {
+        m_indent = 0;
+        if (count < size) {
+            write("\t... ");
+            write(std::to_string(size - count));
+            write(" objects skipped.\n");
+        }
+        write(")\n");
+        flush();
+    }
+}
+} // anonymous namespace
+
+bool RLMWriteResultsDescription(RLMResults *results, int fileDescriptor,
+                                RLMDescriptionOptions *options, NSError **error) {
+    auto sink = [=](std::string_view str) {
+        while (!str.empty()) {
+            ssize_t written = ::write(fileDescriptor, str.data(), str.size());
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw WriteError{errno};
+            }
+            str.remove_prefix(written);
+        }
+    };
+    try {
+        DescriptionWriter(results.realm, options ?: [RLMDescriptionOptions new], sink, 64 * 1024)
+            .write_results(results);
+        return true;
+    }
+    catch (WriteError const& e) {
+        if (error) {
+            *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:e.code userInfo:nil];
+        }
+        return false;
+    }
+}
+
+void RLMLogResultsDescription(RLMResults *results, RLMLogger *logger, RLMLogLevel level,
+                              RLMDescriptionOptions *options) {
+    if (level == RLMLogLevelOff || level > logger.level) {
+        return;
+    }
+    auto sink = [=](std::string_view str) {
+        // Each message is a complete line, so drop the trailing newline
+        if (!str.empty() && str.back() == '\n') {
+            str.remove_suffix(1);
+        }
+        if (!str.empty()) {
+            [logger logLevel:level message:@(std::string(str).c_str())];
+        }
+    };
+    DescriptionWriter(results.realm, options ?: [RLMDescriptionOptions new], sink, 16 * 1024)
+        .write_results(results);
+}
@@ -145,6 +145,23 @@ typedef void (^RLMObjectChangeBlock)(BOOL deleted,
  */
 + (NSArray<NSString *> *)requiredProperties;
 
+/**
+ Override this method to specify the names of string properties whose values
+ should be interned.
+
+ Reading a string property normally creates a new `NSString` each time. For
+ properties with a small number of distinct values, such as a status or a
+ country code, interning makes repeated reads of the same value return the
+ same `NSString` instance from a bounded per-property cache, which avoids the
+ allocation and makes `isEqual:` checks between the values cheap. Values which
+ don't fit in the cache are read normally.
+
+ Only non-collection string properties can be interned.
+
+ @return    An array of property names to intern.
+ */
++ (NSArray<NSString *> *)internedStringProperties;
+
 /**
  Override this method to provide information related to properties containing linking objects.
 
@@ -0,0 +1,31 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#import <Foundation/Foundation.h>
+
+@class RLMJSONImportOptions, RLMRealm;
+
+// Parse objects of the given class from a JSON array or newline-delimited JSON
+// stream and write them directly to the Realm's table. Returns false and sets
+// `error` if the stream could not be read or contained invalid data; objects
+// in transactions which were already committed remain in the Realm. If the
+// Realm was already in a write transaction it is left open on error, with the
+// objects before the invalid one written to it and the invalid one not created.
+// Linked objects created for the invalid object may remain.
+bool RLMImportObjectsFromJSONStream(RLMRealm *realm, NSString *className, NSInputStream *stream,
+                                    RLMJSONImportOptions *options, NSError **error);
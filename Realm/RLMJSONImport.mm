@@ -0,0 +1,924 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#import "RLMJSONImport.hpp"
+
+#import "RLMAccessor.hpp"
+#import "RLMError_Private.hpp"
+#import "RLMObjectSchema_Private.hpp"
+#import "RLMObservation.hpp"
+#import "RLMProperty_Private.h"
+#import "RLMRealm_Private.hpp"
+#import "RLMSchema_Private.h"
+#import "RLMUtil.hpp"
+
+#import <realm/object-store/object.hpp>
+#import <realm/object-store/object_schema.hpp>
+#import <realm/table.hpp>
+
+#import <cmath>
+#import <deque>
+#import <string>
+#import <unordered_map>
+#import <vector>
+
+using namespace realm;
+
+@implementation RLMJSONImportOptions
+- (instancetype)init {
+    if ((self = [super init])) {
+        _objectsPerTransaction = 10'000;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    RLMJSONImportOptions *copy = [[RLMJSONImportOptions alloc] init];
+    copy.updateExisting = _updateExisting;
+    copy.ignoreUnknownKeys = _ignoreUnknownKeys;
+    copy.objectsPerTransaction = _objectsPerTransaction;
+    return copy;
+}
+@end
+
+namespace {
+// Thrown for malformed JSON or values which can't be stored in the target
+// property, and reported to the caller as an NSError
+struct ImportError {
+    NSString *message;
+};
+
+[[noreturn]] void fail(NSString *format, ...) NS_FORMAT_FUNCTION(1, 2);
+[[noreturn]] void fail(NSString *format, ...) {
+    va_list args;
+    va_start(args, format);
+    NSString *message = [[NSString alloc] initWithFormat:format arguments:args];
+    va_end(args);
+    throw ImportError{message};
+}
+
+// A buffered reader over an NSInputStream which never holds more than one
+// buffer's worth of the input in memory
+class JSONInput {
+public:
+    JSONInput(NSInputStream *stream) : m_stream(stream), m_buffer(64 * 1024) { }
+
+    int peek() {
+        if (m_pos == m_end && !fill()) {
+            return -1;
+        }
+        return m_buffer[m_pos];
+    }
+
+    int get() {
+        int c = peek();
+        if (c >= 0) {
+            ++m_pos;
+        }
+        return c;
+    }
+
+    void skip_whitespace() {
+        for (int c = peek(); c == ' ' || c == '\n' || c == '\r' || c == '\t'; c = peek()) {
+            ++m_pos;
+        }
+    }
+
+    void expect(char expected) {
+        skip_whitespace();
+        int c = get();
+        if (c != expected) {
+            fail(@"Expected '%c' but found %@ at offset %llu", expected, describe(c), offset());
+        }
+    }
+
+    void expect_literal(const char *literal) {
+        for (const char *p = literal; *p; ++p) {
+            if (get() != *p) {
+                fail(@"Invalid literal at offset %llu; expected '%s'", offset(), literal);
+            }
+        }
+    }
+
+    void read_string(std::string& out) {
+        expect('"');
+        out.clear();
+        while (true) {
+            // Copy runs of unescaped characters directly from the buffer
+            size_t start = m_pos;
+            while (m_pos < m_end) {
+                uint8_t c = m_buffer[m_pos];
+                if (c == '"' || c == '\\' || c < 0x20) {
+                    break;
+                }
+                ++m_pos;
+            }
+            out.append(reinterpret_cast<const char *>(m_buffer.data() + start), m_pos - start);
+
+            int c = get();
+            if (c == '"') {
+                return;
+            }
+            if (c == '\\') {
+                read_escape(out);
+            }
+            else if (c < 0) {
+                fail(@"Unterminated string at offset %llu", offset());
+            }
+            else if (c < 0x20) {
+                fail(@"Unescaped control character in string at offset %llu", offset());
+            }
+            else {
+                // Only reached when the run ended at the end of the buffer
+                out += static_cast<char>(c);
+            }
+        }
+    }
+
+    // Reads a number, storing its text and whether it was written as an integer
+    void read_number(std::string& text, bool& isInteger) {
+        text.clear();
+        isInteger = true;
+        if (peek() == '-') {
+            text += static_cast<char>(get());
+        }
+        read_digits(text);
+        if (peek() == '.') {
+            isInteger = false;
+            text += static_cast<char>(get());
+            read_digits(text);
+        }
+        if (peek() == 'e' || peek() == 'E') {
+            isInteger = false;
+            text += static_cast<char>(get());
+            if (peek() == '+' || peek() == '-') {
+                text += static_cast<char>(get());
+            }
+            read_digits(text);
+        }
+    }
+
+    uint64_t offset() const {
+        return m_consumed + m_pos;
+    }
+
+    static NSString *describe(int c) {
+        if (c < 0) {
+            return @"end of input";
+        }
+        return [NSString stringWithFormat:@"'%c'", c];
+    }
+
+private:
+    NSInputStream *m_stream;
+    std::vector<uint8_t> m_buffer;
+    size_t m_pos = 0;
+    size_t m_end = 0;
+    uint64_t m_consumed = 0;
+    bool m_eof = false;
+
+    bool fill() {
+        if (m_eof) {
+            return false;
+        }
+        m_consumed += m_end;
+        m_pos = m_end = 0;
+        NSInteger read = [m_stream read:m_buffer.data() maxLength:m_buffer.size()];
+        if (read < 0) {
+            fail(@"Error reading from stream: %@", m_stream.streamError.localizedDescription);
+        }
+        if (read == 0) {
+            m_eof = true;
+            return false;
+        }
+        m_end = static_cast<size_t>(read);
+        return true;
+    }
+
+    void read_digits(std::string& text) {
+        size_t count = 0;
+        for (int c = peek(); c >= '0' && c <= '9'; c = peek(), ++count) {
+            text += static_cast<char>(get());
+        }
+        if (count == 0) {
+            fail(@"Invalid number at offset %llu", offset());
+        }
+    }
+
+    uint32_t read_hex4() {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            int c = get();
+            value <<= 4;
+            if (c >= '0' && c <= '9') value |= c - '0';
+            else if (c >= 'a' && c <= 'f') value |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') value |= c - 'A' + 10;
+            else fail(@"Invalid unicode escape at offset %llu", offset());
+        }
+        return value;
+    }
+
+    void read_escape(std::string& out) {
+        int c = get();
+        switch (c) {
+            case '"': case '\\': case '/': out += static_cast<char>(c); return;
+            case 'b': out += '\b'; return;
+            case 'f': out += '\f'; return;
+            case 'n': out += '\n'; return;
+            case 'r': out += '\r'; return;
+            case 't': out += '\t'; return;
+            case 'u': break;
+            default: fail(@"Invalid escape sequence at offset %llu", offset());
+        }
+
+        uint32_t codepoint = read_hex4();
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+            if (get() != '\\' || get() != 'u') {
+                fail(@"Unpaired surrogate in unicode escape at offset %llu", offset());
+            }
+            uint32_t low = read_hex4();
+            if (low < 0xDC00 || low > 0xDFFF) {
+                fail(@"Unpaired surrogate in unicode escape at offset %llu", offset());
+            }
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+            fail(@"Unpaired surrogate in unicode escape at offset %llu", offset());
+        }
+
+        if (codepoint < 0x80) {
+            out += static_cast<char>(codepoint);
+        }
+        else if (codepoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codepoint >> 6));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else if (codepoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codepoint >> 12));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else {
+            out += static_cast<char>(0xF0 | (codepoint >> 18));
+            out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+    }
+};
+
+// Convert a string read from the input to an NSString. Unlike @(str.c_str())
+// this does not stop at embedded NUL characters, and it reports invalid UTF-8
+// rather than returning nil.
+NSString *toNSString(std::string const& str) {
+    NSString *string = RLMStringDataToNSString(StringData(str));
+    if (!string) {
+        fail(@"Invalid UTF-8 in string value");
+    }
+    return string;
+}
+
+// The per-property information needed to write a value, resolved once per import
+struct ImportProperty {
+    __unsafe_unretained RLMProperty *property;
+    ColKey column;
+    // Links, collections and nested mixed values are parsed into Foundation
+    // objects and set through the accessor context rather than directly
+    bool requiresAccessorContext;
+};
+
+class JSONImporter {
+public:
+    JSONImporter(RLMRealm *realm, RLMClassInfo& info, NSInputStream *stream, RLMJSONImportOptions *options)
+    : m_realm(realm)
+    , m_info(info)
+    , m_input(stream)
+    , m_options(options)
+    , m_context(info)
+    , m_defaults(RLMDefaultValuesForObjectSchema(info.rlmObjectSchema))
+    {
+        for (RLMProperty *prop in info.rlmObjectSchema.properties) {
+            m_propertyIndex.emplace(prop.name.UTF8String, m_properties.size());
+            m_properties.push_back({prop, info.tableColumn(prop),
+                prop.collection || prop.type == RLMPropertyTypeObject});
+        }
+        if (RLMProperty *pk = info.propertyForPrimaryKey()) {
+            m_primaryKeyIndex = m_propertyIndex.at(pk.name.UTF8String);
+        }
+        m_values.resize(m_properties.size());
+        m_nestedValues.resize(m_properties.size());
+        m_present.resize(m_properties.size());
+    }
+
+    bool run(NSError **error);
+
+private:
+    __unsafe_unretained RLMRealm *const m_realm;
+    RLMClassInfo& m_info;
+    JSONInput m_input;
+    RLMJSONImportOptions *m_options;
+    RLMAccessorContext m_context;
+    NSDictionary *m_defaults;
+
+    std::vector<ImportProperty> m_properties;
+    std::unordered_map<std::string, size_t> m_propertyIndex;
+    size_t m_primaryKeyIndex = npos;
+
+    // Storage for the current record. Strings are held in a deque so that the
+    // StringData in m_values remains valid as more are added.
+    std::vector<Mixed> m_values;
+    std::vector<id> m_nestedValues;
+    std::vector<bool> m_present;
+    std::deque<std::string> m_strings;
+    std::string m_key;
+    std::string m_number;
+    uint64_t m_objectCount = 0;
+
+    bool import_all(bool ownsTransaction, NSError **error);
+    void read_record();
+    void read_property_value(size_t index);
+    Mixed read_scalar(ImportProperty const& prop);
+    id read_foundation_value();
+    void skip_value();
+    void validate_nested_value(id value, RLMObjectSchema *objectSchema, RLMProperty *property);
+    void validate_nested_object(id value, RLMObjectSchema *objectSchema);
+    void write_record();
+    void write_values(Obj& obj, bool created);
+    std::string& next_string() { return m_strings.emplace_back(); }
+};
+
+Mixed JSONImporter::read_scalar(ImportProperty const& prop) {
+    RLMProperty *property = prop.property;
+    int c = m_input.peek();
+    if (c == 'n') {
+        m_input.expect_literal("null");
+        if (!property.optional && property.type != RLMPropertyTypeAny) {
+            fail(@"Invalid null value for non-optional property '%@'", property.name);
+        }
+        return Mixed();
+    }
+    if (c == 't' || c == 'f') {
+        m_input.expect_literal(c == 't' ? "true" : "false");
+        if (property.type != RLMPropertyTypeBool && property.type != RLMPropertyTypeAny) {
+            fail(@"Invalid boolean value for %@ property '%@'", RLMTypeToString(property.type), property.name);
+        }
+        return Mixed(c == 't');
+    }
+    if (c == '"') {
+        std::string& str = next_string();
+        m_input.read_string(str);
+        switch (property.type) {
+            case RLMPropertyTypeString:
+            case RLMPropertyTypeAny:
+                return Mixed(StringData(str));
+            case RLMPropertyTypeData: {
+                NSData *encoded = [NSData dataWithBytesNoCopy:str.data() length:str.size() freeWhenDone:NO];
+                NSData *decoded = [[NSData alloc] initWithBase64EncodedData:encoded options:0];
+                if (!decoded) {
+                    fail(@"Invalid base64 value for data property '%@'", property.name);
+                }
+                str.assign(static_cast<const char *>(decoded.bytes), decoded.length);
+                return Mixed(BinaryData(str.data(), str.size()));
+            }
+            case RLMPropertyTypeDate: {
+                NSDate *date = [RLMISO8601Formatter() dateFromString:toNSString(str)];
+                if (!date) {
+                    fail(@"Invalid ISO 8601 date '%s' for property '%@'", str.c_str(), property.name);
+                }
+                return Mixed(RLMTimestampForNSDate(date));
+            }
+            case RLMPropertyTypeObjectId:
+                if (!ObjectId::is_valid_str(str)) {
+                    fail(@"Invalid ObjectId '%s' for property '%@'", str.c_str(), property.name);
+                }
+                return Mixed(ObjectId(str.c_str()));
+            case RLMPropertyTypeUUID:
+                if (!UUID::is_valid_string(str)) {
+                    fail(@"Invalid UUID '%s' for property '%@'", str.c_str(), property.name);
+                }
+                return Mixed(UUID(str));
+            case RLMPropertyTypeDecimal128:
+                if (!Decimal128::is_valid_str(str)) {
+                    fail(@"Invalid Decimal128 '%s' for property '%@'", str.c_str(), property.name);
+                }
+                return Mixed(Decimal128(str));
+            default:
+                fail(@"Invalid string value for %@ property '%@'", RLMTypeToString(property.type), property.name);
+        }
+    }
+    if (c == '-' || (c >= '0' && c <= '9')) {
+        bool isInteger;
+        m_input.read_number(m_number, isInteger);
+        errno = 0;
+        switch (property.type) {
+            case RLMPropertyTypeInt:
+            case RLMPropertyTypeAny:
+                if (isInteger) {
+                    int64_t value = std::strtoll(m_number.c_str(), nullptr, 10);
+                    if (errno == ERANGE) {
+                        fail(@"Integer %s is out of range for property '%@'", m_number.c_str(), property.name);
+                    }
+                    return Mixed(value);
+                }
+                if (property.type == RLMPropertyTypeAny) {
+                    return Mixed(std::strtod(m_number.c_str(), nullptr));
+                }
+                fail(@"Invalid non-integer value %s for int property '%@'", m_number.c_str(), property.name);
+            case RLMPropertyTypeFloat:
+                return Mixed(std::strtof(m_number.c_str(), nullptr));
+            case RLMPropertyTypeDouble:
+                return Mixed(std::strtod(m_number.c_str(), nullptr));
+            case RLMPropertyTypeDecimal128:
+                if (!Decimal128::is_valid_str(m_number)) {
+                    fail(@"Number %s is out of range for Decimal128 property '%@'", m_number.c_str(), property.name);
+                }
+                return Mixed(Decimal128(m_number));
+            case RLMPropertyTypeDate: {
+                // Numeric dates are seconds since the Unix epoch
+                double value = std::strtod(m_number.c_str(), nullptr);
+                double seconds = std::trunc(value);
+                return Mixed(Timestamp(static_cast<int64_t>(seconds),
+                                       static_cast<int32_t>((value - seconds) * 1'000'000'000.0)));
+            }
+            default:
+                fail(@"Invalid numeric value for %@ property '%@'", RLMTypeToString(property.type), property.name);
+        }
+    }
+    fail(@"Unexpected %@ at offset %llu", JSONInput::describe(c), m_input.offset());
+}
+
+id JSONImporter::read_foundation_value() {
+    m_input.skip_whitespace();
+    int c = m_input.peek();
+    switch (c) {
+        case '{': {
+            m_input.get();
+            NSMutableDictionary *dictionary = [NSMutableDictionary new];
+            m_input.skip_whitespace();
+            if (m_input.peek() == '}') {
+                m_input.get();
+                return dictionary;
+            }
+            std::string key;
+            while (true) {
+                m_input.read_string(key);
+                m_input.expect(':');
+                dictionary[toNSString(key)] = read_foundation_value();
+                m_input.skip_whitespace();
+                c = m_input.get();
+                if (c == '}') {
+                    return dictionary;
+                }
+                if (c != ',') {
+                    fail(@"Expected ',' or '}' but found %@ at offset %llu", JSONInput::describe(c), m_input.offset());
+                }
+            }
+        }
+        case '[': {
+            m_input.get();
+            NSMutableArray *array = [NSMutableArray new];
+            m_input.skip_whitespace();
+            if (m_input.peek() == ']') {
+                m_input.get();
+                return array;
+            }
+            while (true) {
+                [array addObject:read_foundation_value()];
+                m_input.skip_whitespace();
+                c = m_input.get();
+                if (c == ']') {
+                    return array;
+                }
+                if (c != ',') {
+                    fail(@"Expected ',' or ']' but found %@ at offset %llu", JSONInput::describe(c), m_input.offset());
+                }
+            }
+        }
+        case '"': {
+            std::string str;
+            m_input.read_string(str);
+            return toNSString(str);
+        }
+        case 't':
+            m_input.expect_literal("true");
+            return @YES;
+        case 'f':
+            m_input.expect_literal("false");
+            return @NO;
+        case 'n':
+            m_input.expect_literal("null");
+            return NSNull.null;
+        default: {
+            if (c != '-' && (c < '0' || c > '9')) {
+                fail(@"Unexpected %@ at offset %llu", JSONInput::describe(c), m_input.offset());
+            }
+            bool isInteger;
+            m_input.read_number(m_number, isInteger);
+            if (isInteger) {
+                return @(std::strtoll(m_number.c_str(), nullptr, 10));
+            }
+            return @(std::strtod(m_number.c_str(), nullptr));
+        }
+    }
+}
+
+void JSONImporter::skip_value() {
+    m_input.skip_whitespace();
+    int c = m_input.peek();
+    if (c == '{' || c == '[') {
+        char close = c == '{' ? '}' : ']';
+        m_input.get();
+        m_input.skip_whitespace();
+        if (m_input.peek() == close) {
+            m_input.get();
+            return;
+        }
+        while (true) {
+            if (close == '}') {
+                m_input.read_string(m_key);
+                m_input.expect(':');
+            }
+            skip_value();
+            m_input.skip_whitespace();
+            c = m_input.get();
+            if (c == close) {
+                return;
+            }
+            if (c != ',') {
+                fail(@"Expected ',' or '%c' but found %@ at offset %llu", close, JSONInput::describe(c), m_input.offset());
+            }
+        }
+    }
+    if (c == '"') {
+        m_input.read_string(m_key);
+        return;
+    }
+    if (c == 't' || c == 'f' || c == 'n') {
+        m_input.expect_literal(c == 't' ? "true" : c == 'f' ? "false" : "null");
+        return;
+    }
+    bool isInteger;
+    m_input.read_number(m_number, isInteger);
+}
+
+void JSONImporter::read_property_value(size_t index) {
+    auto& prop = m_properties[index];
+    m_present[index] = true;
+    m_input.skip_whitespace();
+    int c = m_input.peek();
+    if (prop.requiresAccessorContext || (prop.property.type == RLMPropertyTypeAny && (c == '{' || c == '['))) {
+        m_nestedValues[index] = read_foundation_value();
+    }
+    else {
+        m_nestedValues[index] = nil;
+        m_values[index] = read_scalar(prop);
+    }
+}
+
+void JSONImporter::read_record() {
+    std::fill(m_present.begin(), m_present.end(), false);
+    m_strings.clear();
+
+    m_input.expect('{');
+    m_input.skip_whitespace();
+    if (m_input.peek() == '}') {
+        m_input.get();
+        return write_record();
+    }
+    while (true) {
+        m_input.read_string(m_key);
+        m_input.expect(':');
+        auto it = m_propertyIndex.find(m_key);
+        if (it != m_propertyIndex.end()) {
+            read_property_value(it->second);
+        }
+        else if (m_options.ignoreUnknownKeys) {
+            skip_value();
+        }
+        else {
+            fail(@"Unknown property '%s' for object type '%@'", m_key.c_str(), m_info.rlmObjectSchema.className);
+        }
+
+        m_input.skip_whitespace();
+        int c = m_input.get();
+        if (c == '}') {
+            return write_record();
+        }
+        if (c != ',') {
+            fail(@"Expected ',' or '}' but found %@ at offset %llu", JSONInput::describe(c), m_input.offset());
+        }
+    }
+}
+
+// Check that a value parsed for a link, collection or nested mixed property
+// can be stored in it. The values are written through the accessor context,
+// which would otherwise only reject them after the object had been created.
+void JSONImporter::validate_nested_value(id value, RLMObjectSchema *objectSchema, RLMProperty *property) {
+    RLMValidateValueForProperty(value, objectSchema, property, false);
+    if (property.type != RLMPropertyTypeObject || value == NSNull.null) {
+        return;
+    }
+
+    RLMObjectSchema *target = m_realm.schema[property.objectClassName];
+    auto validate = [&](id object) {
+        if (object == NSNull.null) {
+            if (!property.dictionary) {
+                fail(@"Invalid null value in %@ property '%@.%@'",
+                     property.array ? @"list" : @"set", objectSchema.className, property.name);
+            }
+            return;
+        }
+        validate_nested_object(object, target);
+    };
+    if (!property.collection) {
+        validate(value);
+    }
+    else if (property.dictionary) {
+        for (id key in value) {
+            validate(value[key]);
+        }
+    }
+    else {
+        for (id object in value) {
+            validate(object);
+        }
+    }
+}
+
+void JSONImporter::validate_nested_object(id value, RLMObjectSchema *objectSchema) {
+    NSArray<RLMProperty *> *properties = objectSchema.properties;
+    NSArray *array = RLMDynamicCast<NSArray>(value);
+    if (array && array.count != properties.count) {
+        fail(@"Invalid array input: number of values (%llu) does not match number of properties (%llu) for '%@'",
+             (unsigned long long)array.count, (unsigned long long)properties.count, objectSchema.className);
+    }
+    if (!array && ![value isKindOfClass:NSDictionary.class]) {
+        fail(@"Invalid value '%@' for object of type '%@'", value, objectSchema.className);
+    }
+
+    // Objects with a primary key may be updated rather than created, in which
+    // case missing properties are left unchanged, so only objects which will
+    // always be created need every required property
+    RLMProperty *primaryKey = objectSchema.primaryKeyProperty;
+    NSDictionary *defaults = primaryKey ? nil : RLMDefaultValuesForObjectSchema(objectSchema);
+    for (NSUInteger i = 0; i < properties.count; ++i) {
+        RLMProperty *prop = properties[i];
+        id propertyValue = array ? array[i] : value[prop.name];
+        if (!propertyValue) {
+            if (prop == primaryKey) {
+                fail(@"Missing value for primary key property '%@.%@'", objectSchema.className, prop.name);
+            }
+            if (!primaryKey && !defaults[prop.name] && !prop.optional && !prop.collection
+                && prop.type != RLMPropertyTypeAny && prop.type != RLMPropertyTypeObject) {
+                fail(@"Missing value for property '%@.%@'", objectSchema.className, prop.name);
+            }
+            continue;
+        }
+        if (prop.collection || prop.type == RLMPropertyTypeObject) {
+            validate_nested_value(propertyValue, objectSchema, prop);
+        }
+        else {
+            RLMValidateValueForProperty(propertyValue == NSNull.null ? nil : propertyValue, objectSchema, prop);
+        }
+    }
+}
+
+void JSONImporter::write_record() {
+    TableRef table = m_info.table();
+    RLMObjectSchema *objectSchema = m_info.rlmObjectSchema;
+
+    // Look up the existing object and validate the entire record before
+    // creating anything, so that invalid input does not leave a partially
+    // populated object behind
+    ObjKey existing;
+    Mixed primaryKey;
+    if (m_primaryKeyIndex != npos) {
+        RLMProperty *pk = m_properties[m_primaryKeyIndex].property;
+        if (!m_present[m_primaryKeyIndex]) {
+            fail(@"Missing value for primary key property '%@'", pk.name);
+        }
+        if (m_nestedValues[m_primaryKeyIndex]) {
+            fail(@"Invalid value for primary key property '%@'", pk.name);
+        }
+        primaryKey = m_values[m_primaryKeyIndex];
+        existing = table->find_primary_key(primaryKey);
+        if (existing && !m_options.updateExisting) {
+            fail(@"Attempting to create an object of type '%@' with an existing primary key value '%s'.",
+                 objectSchema.className, util::format("%1", primaryKey).c_str());
+        }
+    }
+    bool created = !existing;
+    for (size_t i = 0; i < m_properties.size(); ++i) {
+        if (i == m_primaryKeyIndex) {
+            continue;
+        }
+        RLMProperty *prop = m_properties[i].property;
+        if (m_present[i]) {
+            if (m_nestedValues[i]) {
+                validate_nested_value(m_nestedValues[i], objectSchema, prop);
+            }
+        }
+        else if (created && !m_defaults[prop.name] && !prop.optional && !prop.collection
+                 && prop.type != RLMPropertyTypeAny && prop.type != RLMPropertyTypeObject) {
+            fail(@"Missing value for property '%@.%@'", objectSchema.className, prop.name);
+        }
+    }
+
+    Obj obj;
+    if (existing) {
+        obj = table->get_object(existing);
+    }
+    else if (m_primaryKeyIndex != npos) {
+        obj = table->create_object_with_primary_key(primaryKey);
+    }
+    else {
+        obj = table->create_object();
+    }
+
+    try {
+        write_values(obj, created);
+    }
+    catch (...) {
+        // Errors which can only be detected while writing (such as a nested
+        // object with a duplicate primary key) must still not leave a
+        // partially written object in the caller's transaction
+        if (created && obj.is_valid()) {
+            obj.remove();
+        }
+        throw;
+    }
+    ++m_objectCount;
+}
+
+void JSONImporter::write_values(Obj& obj, bool created) {
+    // Existing objects may be observed, so the KVO notifications which would
+    // have been sent by the accessor setters need to be sent manually
+    RLMObservationInfo *observationInfo = created ? nullptr : RLMGetObservationInfo(nullptr, obj.get_key(), m_info);
+    std::unique_ptr<realm::Object> object;
+
+    for (size_t i = 0; i < m_properties.size(); ++i) {
+        if (i == m_primaryKeyIndex) {
+            continue;
+        }
+        auto& prop = m_properties[i];
+        id value;
+        if (m_present[i]) {
+            if (!m_nestedValues[i]) {
+                if (observationInfo) {
+                    observationInfo->willChange(prop.property.name);
+                }
+                obj.set_any(prop.column, m_values[i]);
+                if (observationInfo) {
+                    observationInfo->didChange(prop.property.name);
+                }
+                continue;
+            }
+            value = m_nestedValues[i];
+            m_nestedValues[i] = nil;
+        }
+        else if (created) {
+            // Required properties without a default were rejected before the
+            // object was created
+            value = m_defaults[prop.property.name];
+            if (!value) {
+                continue;
+            }
+        }
+        else {
+            continue;
+        }
+
+        if (!object) {
+            object = std::make_unique<realm::Object>(m_realm->_realm, *m_info.objectSchema, obj);
+        }
+        // The accessor context sends its own KVO notifications
+        object->set_property_value(m_context, prop.property.name.UTF8String, value,
+                                   m_options.updateExisting ? CreatePolicy::UpdateAll : CreatePolicy::ForceCreate);
+    }
+}
+
+bool JSONImporter::import_all(bool ownsTransaction, NSError **error) {
+    NSUInteger perTransaction = m_options.objectsPerTransaction ?: NSUIntegerMax;
+    if (ownsTransaction) {
+        [m_realm beginWriteTransaction];
+    }
+
+    // The input is either a single array of objects, or a sequence of
+    // objects optionally separated by whitespace (i.e. newline-delimited JSON)
+    m_input.skip_whitespace();
+    bool isArray = m_input.peek() == '[';
+    if (isArray) {
+        m_input.get();
+        m_input.skip_whitespace();
+        if (m_input.peek() == ']') {
+            m_input.get();
+            isArray = false;
+        }
+    }
+
+    NSUInteger inTransaction = 0;
+    while (true) {
+        m_input.skip_whitespace();
+        if (!isArray && m_input.peek() < 0) {
+            break;
+        }
+        @autoreleasepool {
+            read_record();
+        }
+
+        if (ownsTransaction && ++inTransaction == perTransaction) {
+            inTransaction = 0;
+            if (![m_realm commitWriteTransaction:error]) {
+                if (m_realm.inWriteTransaction) {
+                    [m_realm cancelWriteTransaction];
+                }
+                return false;
+            }
+            [m_realm beginWriteTransaction];
+        }
+
+        if (isArray) {
+            m_input.skip_whitespace();
+            int c = m_input.get();
+            if (c == ']') {
+                break;
+            }
+            if (c != ',') {
+                fail(@"Expected ',' or ']' but found %@ at offset %llu", JSONInput::describe(c), m_input.offset());
+            }
+        }
+    }
+
+    if (ownsTransaction) {
+        return [m_realm commitWriteTransaction:error];
+    }
+    return true;
+}
+
+bool JSONImporter::run(NSError **error) {
+    bool ownsTransaction = !m_realm.inWriteTransaction;
+    auto handleError = [&](NSString *message) {
+        if (ownsTransaction && m_realm.inWriteTransaction) {
+            [m_realm cancelWriteTransaction];
+        }
+        if (error) {
+            *error = [NSError errorWithDomain:RLMErrorDomain code:RLMErrorInvalidInput
+                                     userInfo:@{NSLocalizedDescriptionKey:
+                                                    [NSString stringWithFormat:@"Failed to import object %llu: %@",
+                                                     m_objectCount, message]}];
+        }
+        return false;
+    };
+
+    @try {
+        try {
+            return import_all(ownsTransaction, error);
+        }
+        catch (ImportError const& e) {
+            return handleError(e.message);
+        }
+        catch (std::exception const& e) {
+            return handleError(@(e.what()));
+        }
+    }
+    @catch (NSException *e) {
+        return handleError(e.reason);
+    }
+}
+} // anonymous namespace
+
+bool RLMImportObjectsFromJSONStream(RLMRealm *realm, NSString *className, NSInputStream *stream,
+                                    RLMJSONImportOptions *options, NSError **error) {
+    RLMClassInfo& info = realm->_info[className];
+    if (info.rlmObjectSchema.isEmbedded) {
+        @throw RLMException(@"Embedded objects of type '%@' cannot be imported directly.", className);
+    }
+    if (options.updateExisting && !info.propertyForPrimaryKey()) {
+        @throw RLMException(@"'%@' does not have a primary key and can not be updated", className);
+    }
+
+    bool opened = stream.streamStatus == NSStreamStatusNotOpen;
+    if (opened) {
+        [stream open];
+    }
+    bool success = JSONImporter(realm, info, stream, options ?: [RLMJSONImportOptions new]).run(error);
+    if (opened) {
+        [stream close];
+    }
+    return success;
+}
@@ -87,6 +87,64 @@ typedef void (^RLMLogFunction)(RLMLogLevel level, NSString *message);
 */
 - (instancetype)initWithLevel:(RLMLogLevel)level logFunction:(RLMLogFunction)logFunction;
 
+/**
+ Creates a logger which calls the log function asynchronously on a dedicated
+ thread rather than on the thread which logged the message.
+
+ Messages are added to a fixed-size buffer without taking any locks, and the
+ log function is called for each of them in order on the logger's thread, a
+ batch at a time. If messages are logged faster than the log function can
+ process them and the buffer fills up, new messages are discarded and counted
+ in `droppedMessageCount`, and a warning reporting the number of discarded
+ messages is passed to the log function once there is space again.
+
+ @param level The log level to be set for the logger.
+ @param bufferCapacity The maximum number of messages which can be waiting to
+                       be passed to the log function. Rounded up to a power of two.
+                       Capacities larger than 1,048,576 throw an exception.
+ @param logFunction The log function which will be invoked on the logger's
+                    thread for each message.
+*/
+- (instancetype)initWithLevel:(RLMLogLevel)level
+               bufferCapacity:(NSUInteger)bufferCapacity
+                  logFunction:(RLMLogFunction)logFunction;
+
+/**
+ The number of messages which have been discarded because the buffer of an
+ asynchronous logger was full. Always zero for other loggers.
+ */
+@property (nonatomic, readonly) NSUInteger droppedMessageCount;
+
+/**
+ Blocks until all messages logged before this call have been passed to the log
+ function. Does nothing for loggers which are not asynchronous.
+
+ This must not be called from within the log function.
+ */
+- (void)flush;
+
+/**
+ Sets the logging threshold level for a single category of log messages, and
+ all of its subcategories.
+
+ Categories are named hierarchically, such as `Realm.Storage.Query` or
+ `Realm.Sync.Client`. Messages in a category below its threshold are discarded
+ before they are formatted, so raising the threshold of noisy categories avoids
+ most of the cost of their messages. Setting `level` sets the threshold of the
+ `Realm` category, and so overrides any thresholds set for its subcategories.
+
+ @param level The log level to be set for the category.
+ @param category The full name of the category.
+ */
+- (void)setLevel:(RLMLogLevel)level forCategory:(NSString *)category;
+
+/**
+ Gets the logging threshold level for a single category of log messages.
+
+ @param category The full name of the category.
+ */
+- (RLMLogLevel)levelForCategory:(NSString *)category;
+
 #pragma mark RLMLogger Default Logger API
 
 /**
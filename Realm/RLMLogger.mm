@@ -22,6 +22,12 @@
 
 #import <realm/util/logger.hpp>
 
+#import <atomic>
+#import <condition_variable>
+#import <mutex>
+#import <pthread.h>
+#import <thread>
+
 typedef void (^RLMLoggerFunction)(RLMLogLevel level, NSString *message);
 
 using namespace realm;
@@ -91,6 +97,204 @@ public:
         }
     }
 };
+
+// A bounded multi-producer queue of log messages, based on Dmitry Vyukov's
+// bounded MPMC queue. Each cell has a sequence number which tells producers
+// and the consumer whether the cell is free to write or ready to read, so
+// pushing a message only needs a single CAS on the enqueue position.
+class LogRingBuffer {
+public:
+    LogRingBuffer(size_t capacity) : m_cells(capacity), m_mask(capacity - 1) {
+        REALM_ASSERT((capacity & m_mask) == 0);
+        for (size_t i = 0; i < capacity; ++i) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Returns false if the buffer is full
+    bool push(Level level, const std::string& message) {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &m_cells[pos & m_mask];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->level = level;
+        cell->message = message;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Only called from the consumer thread. Returns false if the next message
+    // has not been fully written yet.
+    bool pop(Level& level, std::string& message) {
+        Cell& cell = m_cells[m_dequeuePos & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePos + 1) {
+            return false;
+        }
+        level = cell.level;
+        message.swap(cell.message);
+        cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+        ++m_dequeuePos;
+        return true;
+    }
+
+    // The number of messages which have been pushed (or are being pushed)
+    size_t pushed() const noexcept {
+        return m_enqueuePos.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        Level level;
+        std::string message;
+    };
+    std::vector<Cell> m_cells;
+    const size_t m_mask;
+    alignas(64) std::atomic<size_t> m_enqueuePos{0};
+    alignas(64) size_t m_dequeuePos = 0;
+};
+
+// The state shared between an AsyncLogger and its thread. The thread holds a
+// strong reference so that the logger can be destroyed from within the log
+// function without the thread's state going away underneath it.
+struct AsyncLoggerState {
+    static constexpr size_t maxBatchSize = 256;
+
+    AsyncLoggerState(size_t capacity, RLMLoggerFunction function)
+    : buffer(capacity), function(function) { }
+
+    LogRingBuffer buffer;
+    const RLMLoggerFunction function;
+    dispatch_semaphore_t wakeup = dispatch_semaphore_create(0);
+    std::atomic<bool> stopping{false};
+    std::atomic<size_t> dropped{0};
+
+    std::mutex mutex;
+    std::condition_variable delivered_cv;
+    size_t delivered = 0;
+
+    void run() {
+        pthread_setname_np("io.realm.logger");
+        size_t reportedDrops = 0;
+        Level level;
+        std::string message;
+        while (true) {
+            dispatch_semaphore_wait(wakeup, DISPATCH_TIME_FOREVER);
+            bool stop = stopping.load();
+            size_t count;
+            do {
+                count = 0;
+                @autoreleasepool {
+                    while (count < maxBatchSize && buffer.pop(level, message)) {
+                        function(logLevelForLevel(level), RLMStringDataToNSString(message));
+                        ++count;
+                    }
+                    if (size_t drops = dropped.load(std::memory_order_relaxed); drops != reportedDrops) {
+                        function(RLMLogLevelWarn, [NSString stringWithFormat:@"%zu log messages were dropped because the log buffer was full.",
+                                                   drops - reportedDrops]);
+                        reportedDrops = drops;
+                    }
+                }
+                if (count) {
+                    std::lock_guard lock(mutex);
+                    delivered += count;
+                }
+                delivered_cv.notify_all();
+            } while (count == maxBatchSize);
+            if (stop) {
+                return;
+            }
+        }
+    }
+
+    void flush() {
+        size_t target = buffer.pushed();
+        dispatch_semaphore_signal(wakeup);
+        std::unique_lock lock(mutex);
+        delivered_cv.wait(lock, [&] { return delivered >= target; });
+    }
+};
+
+class AsyncLogger : public Logger {
+public:
+    AsyncLogger(size_t capacity, RLMLoggerFunction function)
+    : m_state(std::make_shared<AsyncLoggerState>(capacity, function))
+    , m_thread([state = m_state] { state->run(); })
+    {
+    }
+
+    ~AsyncLogger() {
+        m_state->stopping = true;
+        dispatch_semaphore_signal(m_state->wakeup);
+        if (m_thread.get_id() == std::this_thread::get_id()) {
+            // The last reference was released by the log function, so the
+            // thread will exit after it returns
+            m_thread.detach();
+        }
+        else {
+            m_thread.join();
+        }
+    }
+
+    void do_log(const realm::util::LogCategory&, Level level, const std::string& message) override {
+        if (m_state->buffer.push(level, message)) {
+            dispatch_semaphore_signal(m_state->wakeup);
+        }
+        else {
+            m_state->dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    size_t dropped() const noexcept {
+        return m_state->dropped.load(std::memory_order_relaxed);
+    }
+
+    void flush() {
+        m_state->flush();
+    }
+
+private:
+    std::shared_ptr<AsyncLoggerState> m_state;
+    std::thread m_thread;
+};
+
+static size_t roundUpToPowerOfTwo(NSUInteger value) {
+    // Each cell holds a std::string, so this is already tens of megabytes and
+    // anything much larger would fail to allocate rather than being useful
+    constexpr size_t maxCapacity = size_t(1) << 20;
+    if (value > maxCapacity) {
+        @throw RLMException(@"Invalid buffer capacity %llu: must be at most %llu.",
+                            (unsigned long long)value, (unsigned long long)maxCapacity);
+    }
+    size_t capacity = 2;
+    while (capacity < value) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+static const realm::util::LogCategory& categoryForName(NSString *name) {
+    try {
+        return realm::util::LogCategory::get_category(name.UTF8String);
+    }
+    catch (...) {
+        @throw RLMException(@"Invalid log category '%@'.", name);
+    }
+}
 } // anonymous namespace
 
 @implementation RLMLogger {
@@ -130,6 +334,38 @@ typedef void(^LoggerBlock)(RLMLogLevel level, NSString *message);
     return self;
 }
 
+- (instancetype)initWithLevel:(RLMLogLevel)level
+               bufferCapacity:(NSUInteger)bufferCapacity
+                  logFunction:(RLMLogFunction)logFunction {
+    if (self = [super init]) {
+        auto logger = std::make_shared<AsyncLogger>(roundUpToPowerOfTwo(bufferCapacity), logFunction);
+        logger->set_level_threshold(levelForLogLevel(level));
+        self->_logger = logger;
+    }
+    return self;
+}
+
+- (NSUInteger)droppedMessageCount {
+    if (auto logger = dynamic_cast<AsyncLogger *>(_logger.get())) {
+        return logger->dropped();
+    }
+    return 0;
+}
+
+- (void)flush {
+    if (auto logger = dynamic_cast<AsyncLogger *>(_logger.get())) {
+        logger->flush();
+    }
+}
+
+- (void)setLevel:(RLMLogLevel)level forCategory:(NSString *)category {
+    _logger->set_level_threshold(categoryForName(category).get_name(), levelForLogLevel(level));
+}
+
+- (RLMLogLevel)levelForCategory:(NSString *)category {
+    return logLevelForLevel(_logger->get_level_threshold(categoryForName(category).get_name()));
+}
+
 - (void)logWithLevel:(RLMLogLevel)logLevel message:(NSString *)message, ... {
     auto level = levelForLogLevel(logLevel);
     if (_logger->would_log(level)) {
@@ -418,7 +418,7 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
     if (_property->_type != RLMPropertyTypeObject) {
         @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
     }
-    auto query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema, _realm.schema, _realm.group);
+    auto query = RLMPredicateToQuery(predicate, *_objectInfo);
     auto results = translateErrors([&] { return _backingList.filter(std::move(query)); });
     return [RLMResults resultsWithObjectInfo:*_objectInfo results:std::move(results)];
 }
@@ -427,8 +427,7 @@ static void RLMInsertObject(RLMManagedArray *ar, id object, NSUInteger index) {
     if (_property->_type != RLMPropertyTypeObject) {
         @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
     }
-    realm::Query query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema,
-                                             _realm.schema, _realm.group);
+    realm::Query query = RLMPredicateToQuery(predicate, *_objectInfo);
 
     return translateErrors([&] {
         return RLMConvertNotFound(_backingList.find(std::move(query)));
@@ -433,7 +433,7 @@ static NSMutableArray *resultsToArray(RLMClassInfo& info, realm::Results r) {
     if (_property->_type != RLMPropertyTypeObject) {
         @throw RLMException(@"Querying is currently only implemented for dictionaries of Realm Objects");
     }
-    auto query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema, _realm.schema, _realm.group);
+    auto query = RLMPredicateToQuery(predicate, *_objectInfo);
     auto results = translateErrors([&] {
         return _backingCollection.as_results().filter(std::move(query));
     });
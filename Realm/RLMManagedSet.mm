@@ -452,7 +452,7 @@ static void ensureInWriteTransaction(NSString *message, RLMManagedSet *set, RLMM
     if (_type != RLMPropertyTypeObject) {
         @throw RLMException(@"Querying is currently only implemented for sets of Realm Objects");
     }
-    auto query = RLMPredicateToQuery(predicate, _objectInfo->rlmObjectSchema, _realm.schema, _realm.group);
+    auto query = RLMPredicateToQuery(predicate, *_objectInfo);
     auto results = translateErrors([&] { return _backingSet.filter(std::move(query)); });
     return [RLMResults resultsWithObjectInfo:*_objectInfo results:std::move(results)];
 }
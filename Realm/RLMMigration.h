@@ -23,6 +23,8 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
 @class RLMSchema;
 @class RLMArray;
 @class RLMObject;
+@class RLMPropertyConverter;
+@protocol RLMValue;
 
 /**
  A block type which provides both the old and new versions of an object in the Realm. Object
@@ -35,6 +37,35 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
 */
 typedef void (^RLMObjectMigrationBlock)(RLMObject * __nullable oldObject, RLMObject * __nullable newObject);
 
+/**
+ A block type which computes new property values for an object from the values
+ of its persisted properties in the old schema.
+
+ @see `-[RLMMigration transformObjects:batchSize:block:]`
+
+ @param oldValues The values of the object's properties before the migration,
+                  keyed by property name. Properties which link to other objects
+                  are not included.
+
+ @return The values to set on the migrated object keyed by property name, or
+         `nil` to leave the object unchanged.
+*/
+RLM_SWIFT_SENDABLE
+typedef NSDictionary<NSString *, id> * _Nullable (^RLMObjectTransformBlock)(NSDictionary<NSString *, id> *oldValues);
+
+/**
+ A block type which computes the new value of a property from its value before
+ the migration.
+
+ @see `-[RLMMigration transformProperty:ofClass:using:]`
+
+ @param oldValue The value of the property before the migration, or `nil` if
+                 the object or property did not exist before the migration.
+
+ @return The new value of the property.
+*/
+typedef id<RLMValue> _Nullable (^RLMPropertyTransformBlock)(id<RLMValue> _Nullable oldValue);
+
 /**
  `RLMMigration` instances encapsulate information intended to facilitate a schema migration.
 
@@ -74,6 +105,124 @@ typedef void (^RLMObjectMigrationBlock)(RLMObject * __nullable oldObject, RLMObj
 - (void)enumerateObjects:(NSString *)className
                    block:(__attribute__((noescape, swift_attr("@nonSendable"))) RLMObjectMigrationBlock)block NS_REFINED_FOR_SWIFT;
 
+/**
+ Computes new property values for all the objects of a given type in the Realm
+ from their values before the migration, running the block concurrently on
+ multiple threads.
+
+ This is much faster than `-enumerateObjects:block:` for migrations which only
+ need to compute new values for each object from its old values, as no
+ `RLMObject` accessors are created and the block is run on every available
+ core. Objects are read from a snapshot of the Realm as it was before the
+ migration and the values returned by the block are written to the migrated
+ objects in the order the objects were read, `batchSize` objects at a time, so
+ only one batch of values is held in memory at once.
+
+ The block must not access the Realm or the migration, and must be safe to call
+ concurrently from multiple threads. Objects which were deleted earlier in the
+ migration are skipped.
+
+ @param className The name of the `RLMObject` class to transform. This class
+                  must be present in both the old and new Realm schemas.
+ @param batchSize The number of objects to transform before writing the new
+                  values. Must be greater than zero.
+ @param block     The block which computes the new values for each object.
+ */
+- (void)transformObjects:(NSString *)className
+               batchSize:(NSUInteger)batchSize
+                   block:(RLMObjectTransformBlock)block NS_REFINED_FOR_SWIFT;
+
+/**
+ Copies the values of a property in the old schema to a property in the new
+ schema for every object of the given class, converting them to the type of the
+ new property.
+
+ The values are read and written directly without creating any `RLMObject`
+ accessors. Numbers are converted to and from strings, integers to and from
+ floating point numbers when no precision is lost, bools to and from the
+ integers 0 and 1, and `RLMObjectId`, `RLMDecimal128` and `NSUUID` values to
+ and from their string representations. An exception is thrown if a value
+ cannot be converted, or if the old value is `nil` and the new property is not
+ optional. Objects created during the migration are left unchanged.
+
+ @param oldName   The name of the property in the old schema to read from.
+ @param newName   The name of the property in the new schema to write to. This
+                  may be the same as `oldName` if only the property's type has
+                  changed.
+ @param className The name of the class whose property should be copied. This
+                  class must be present in both the old and new Realm schemas.
+ */
+- (void)copyValuesOfProperty:(NSString *)oldName toProperty:(NSString *)newName
+                     ofClass:(NSString *)className NS_REFINED_FOR_SWIFT;
+
+/**
+ Sets a property on every object of the given class to a value computed from
+ the property's value before the migration.
+
+ This reads and writes the property directly without creating any `RLMObject`
+ accessors. Values returned by the block are converted to the type of the
+ property as by `RLMPropertyConverter.typeConversion`.
+
+     [migration transformProperty:@"age" ofClass:@"Person" using:^(id<RLMValue> oldValue) {
+         return @([(NSString *)oldValue integerValue]);
+     }];
+
+ @param propertyName The name of the property to transform.
+ @param className    The name of the class whose property should be
+                     transformed. This class must be present in both the old
+                     and new Realm schemas.
+ @param block        The block which computes the new value of the property.
+ */
+- (void)transformProperty:(NSString *)propertyName ofClass:(NSString *)className
+                    using:(RLMPropertyTransformBlock)block NS_REFINED_FOR_SWIFT;
+
+/**
+ Sets a property on every object of the given class to a value computed from
+ the value of a possibly different property before the migration.
+
+ If the old schema has no property named `oldName`, or an object did not exist
+ before the migration, the block is passed `nil`, which can be used to give a
+ new property a default value.
+
+ @param oldName   The name of the property in the old schema to read from.
+ @param className The name of the class whose property should be transformed.
+                  This class must be present in both the old and new Realm
+                  schemas.
+ @param newName   The name of the property in the new schema to write to.
+ @param block     The block which computes the new value of the property.
+ */
+- (void)transformProperty:(NSString *)oldName ofClass:(NSString *)className
+               toProperty:(NSString *)newName
+                    using:(RLMPropertyTransformBlock)block NS_REFINED_FOR_SWIFT;
+
+/**
+ Sets a property on every object of the given class to a value computed from
+ the value of a possibly different property before the migration using one of
+ the built-in converters.
+
+ Built-in converters run entirely on the values stored in the Realm without
+ creating any Objective-C objects, and so are much faster than passing a block.
+
+     // Split "name" into "firstName" and "lastName"
+     RLMPropertyConverter *first = [RLMPropertyConverter componentSeparatedByString:@" " atIndex:0];
+     RLMPropertyConverter *last = [RLMPropertyConverter componentSeparatedByString:@" " atIndex:1];
+     [migration transformProperty:@"name" ofClass:@"Person" toProperty:@"firstName" withConverter:first];
+     [migration transformProperty:@"name" ofClass:@"Person" toProperty:@"lastName" withConverter:last];
+
+ @param oldName   The name of the property in the old schema to read from. If
+                  there is no such property, the converter is given `nil` for
+                  every object.
+ @param className The name of the class whose property should be transformed.
+                  This class must be present in both the old and new Realm
+                  schemas.
+ @param newName   The name of the property in the new schema to write to.
+ @param converter The converter which computes the new value of the property.
+ */
+- (void)transformProperty:(NSString *)oldName ofClass:(NSString *)className
+               toProperty:(NSString *)newName
+            withConverter:(RLMPropertyConverter *)converter
+NS_SWIFT_NAME(__transformProperty(_:ofClass:toProperty:converter:));
+
 /**
  Creates and returns an `RLMObject` instance of type `className` in the Realm being migrated.
 
@@ -126,4 +275,37 @@ typedef void (^RLMObjectMigrationBlock)(RLMObject * __nullable oldObject, RLMObj
 
 @end
 
+/**
+ A built-in conversion of property values for use with
+ `-[RLMMigration transformProperty:ofClass:toProperty:withConverter:]`.
+ */
+RLM_SWIFT_SENDABLE NS_SWIFT_NAME(PropertyConverter)
+@interface RLMPropertyConverter : NSObject
+
+/**
+ Converts values to the type of the new property. Numbers are converted to and
+ from strings, integers to and from floating point numbers when no precision is
+ lost, bools to and from the integers 0 and 1, and `RLMObjectId`,
+ `RLMDecimal128` and `NSUUID` values to and from their string representations.
+ Values which cannot be converted throw an exception.
+ */
+@property (class, nonatomic, readonly) RLMPropertyConverter *typeConversion;
+
+/**
+ Converts values to the type of the new property as `typeConversion` does,
+ using `defaultValue` in place of `nil`.
+ */
++ (instancetype)typeConversionWithDefault:(id<RLMValue>)defaultValue
+NS_SWIFT_NAME(typeConversion(default:));
+
+/**
+ Splits string values by `separator` and converts the component at `index` to
+ the type of the new property. If the string has fewer components, the new
+ value is `nil`.
+ */
++ (instancetype)componentSeparatedByString:(NSString *)separator atIndex:(NSUInteger)index
+NS_SWIFT_NAME(component(separatedBy:at:));
+
+@end
+
 RLM_HEADER_AUDIT_END(nullability, sendability)
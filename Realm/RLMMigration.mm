@@ -19,6 +19,7 @@
 #import "RLMMigration_Private.h"
 
 #import "RLMAccessor.h"
+#import "RLMAccessor.hpp"
 #import "RLMObject_Private.h"
 #import "RLMObject_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
@@ -30,17 +31,396 @@
 #import "RLMSchema_Private.hpp"
 #import "RLMUtil.hpp"
 
+#import <realm/db.hpp>
+#import <realm/dictionary.hpp>
+#import <realm/object-store/object.hpp>
 #import <realm/object-store/object_store.hpp>
 #import <realm/object-store/shared_realm.hpp>
 #import <realm/object-store/schema.hpp>
 #import <realm/table.hpp>
 
+#import <cmath>
+#import <exception>
+#import <functional>
+#import <map>
+#import <optional>
+#import <set>
+
 using namespace realm;
 
+namespace {
+RLMClassInfo& migrationClassInfo(RLMRealm *realm, NSString *className, NSString *schemaName) {
+    if (![realm.schema schemaForClassName:className]) {
+        @throw RLMException(@"Object type '%@' is not present in the %@ schema.", className, schemaName);
+    }
+    return realm->_info[className];
+}
+
+RLMProperty *migrationProperty(RLMClassInfo& info, NSString *name, NSString *schemaName) {
+    RLMProperty *prop = info.rlmObjectSchema[name];
+    if (!prop) {
+        @throw RLMException(@"Property '%@' is not present on '%@' in the %@ schema.",
+                            name, info.rlmObjectSchema.className, schemaName);
+    }
+    if (prop.collection || prop.type == RLMPropertyTypeObject || prop.type == RLMPropertyTypeLinkingObjects) {
+        @throw RLMException(@"Property '%@.%@' is of type '%@' and cannot be copied: only properties holding a single non-object value are supported.",
+                            info.rlmObjectSchema.className, name, RLMTypeToString(prop.type));
+    }
+    return prop;
+}
+
+// The value passed to transform blocks for a value read from the old schema.
+// This has to be done without a Realm as it happens on a background thread,
+// so links are not included.
+id migrationValue(Mixed const& value) {
+    if (value.is_type(type_Link, type_TypedLink, type_List, type_Dictionary)) {
+        return NSNull.null;
+    }
+    return RLMMixedToObjc(value) ?: NSNull.null;
+}
+
+template <typename Collection>
+id migrationCollectionValue(Collection const& collection, bool set) {
+    std::vector<id> values;
+    values.reserve(collection.size());
+    for (size_t i = 0; i < collection.size(); ++i) {
+        values.push_back(migrationValue(collection.get_any(i)));
+    }
+    if (set) {
+        return [NSSet setWithObjects:values.data() count:values.size()];
+    }
+    return [NSArray arrayWithObjects:values.data() count:values.size()];
+}
+
+NSDictionary *readMigrationValues(Obj const& obj, RLMClassInfo& info) {
+    auto values = [NSMutableDictionary dictionaryWithCapacity:info.rlmObjectSchema.properties.count];
+    for (RLMProperty *prop in info.rlmObjectSchema.properties) {
+        if (prop.type == RLMPropertyTypeObject || prop.type == RLMPropertyTypeLinkingObjects) {
+            continue;
+        }
+        ColKey col = info.tableColumn(prop);
+        if (prop.dictionary) {
+            auto dictionary = obj.get_dictionary(col);
+            auto dict = [NSMutableDictionary dictionaryWithCapacity:dictionary.size()];
+            for (auto [key, value] : dictionary) {
+                dict[RLMStringDataToNSString(key.get_string())] = migrationValue(value);
+            }
+            values[prop.name] = dict;
+        }
+        else if (prop.collection) {
+            values[prop.name] = migrationCollectionValue(*obj.get_collection_ptr(col), prop.set);
+        }
+        else {
+            values[prop.name] = migrationValue(obj.get_any(col));
+        }
+    }
+    return values;
+}
+
+std::optional<DataType> dataTypeForProperty(RLMPropertyType type) {
+    switch (type) {
+        case RLMPropertyTypeInt:        return type_Int;
+        case RLMPropertyTypeBool:       return type_Bool;
+        case RLMPropertyTypeFloat:      return type_Float;
+        case RLMPropertyTypeDouble:     return type_Double;
+        case RLMPropertyTypeString:     return type_String;
+        case RLMPropertyTypeData:       return type_Binary;
+        case RLMPropertyTypeDate:       return type_Timestamp;
+        case RLMPropertyTypeObjectId:   return type_ObjectId;
+        case RLMPropertyTypeDecimal128: return type_Decimal;
+        case RLMPropertyTypeUUID:       return type_UUID;
+        default:                        return std::nullopt;
+    }
+}
+
+std::optional<int64_t> parseInt(StringData str) {
+    std::string s(str);
+    char *end;
+    errno = 0;
+    long long value = strtoll(s.c_str(), &end, 10);
+    if (s.empty() || *end || errno == ERANGE) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+std::optional<double> parseDouble(StringData str) {
+    std::string s(str);
+    char *end;
+    double value = strtod(s.c_str(), &end);
+    if (s.empty() || *end) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+std::optional<int64_t> exactInt(double value) {
+    // 2^63 is exactly representable, while INT64_MAX is not
+    if (std::trunc(value) != value || value < -0x1p63 || value >= 0x1p63) {
+        return std::nullopt;
+    }
+    return static_cast<int64_t>(value);
+}
+
+// Convert a value read from the old schema to the given type.
+// Strings produced by the conversion are stored in `buffer`, which must
+// outlive the returned value.
+std::optional<Mixed> convertMigrationValue(Mixed const& value, RLMPropertyType type, std::string& buffer) {
+    auto targetType = dataTypeForProperty(type);
+    if (!targetType || value.is_null() || value.get_type() == *targetType) {
+        return value;
+    }
+
+    auto string = [&](std::string str) -> Mixed {
+        buffer = std::move(str);
+        return StringData(buffer);
+    };
+    auto shortestDouble = [](double d, int precision) {
+        char str[32];
+        snprintf(str, sizeof(str), "%.*g", precision - 2, d);
+        if (strtod(str, nullptr) != d) {
+            snprintf(str, sizeof(str), "%.*g", precision, d);
+        }
+        return std::string(str);
+    };
+
+    switch (*targetType) {
+        case type_Int:
+            switch (value.get_type()) {
+                case type_Bool:   return Mixed(int64_t(value.get_bool()));
+                case type_Float:  if (auto i = exactInt(value.get_float())) return Mixed(*i); break;
+                case type_Double: if (auto i = exactInt(value.get_double())) return Mixed(*i); break;
+                case type_String: if (auto i = parseInt(value.get_string())) return Mixed(*i); break;
+                default: break;
+            }
+            break;
+        case type_Bool:
+            if (value.is_type(type_Int) && (value.get_int() == 0 || value.get_int() == 1)) {
+                return Mixed(value.get_int() == 1);
+            }
+            if (value.is_type(type_String) && (value.get_string() == "true" || value.get_string() == "false")) {
+                return Mixed(value.get_string() == "true");
+            }
+            break;
+        case type_Double:
+            switch (value.get_type()) {
+                case type_Float: return Mixed(double(value.get_float()));
+                case type_Int:
+                    if (double d = double(value.get_int()); exactInt(d) == value.get_int()) return Mixed(d);
+                    break;
+                case type_String: if (auto d = parseDouble(value.get_string())) return Mixed(*d); break;
+                default: break;
+            }
+            break;
+        case type_Float:
+            switch (value.get_type()) {
+                case type_Double:
+                    if (float f = float(value.get_double()); double(f) == value.get_double()) return Mixed(f);
+                    break;
+                case type_Int:
+                    if (float f = float(value.get_int()); exactInt(f) == value.get_int()) return Mixed(f);
+                    break;
+                case type_String:
+                    if (auto d = parseDouble(value.get_string()); d && double(float(*d)) == *d) return Mixed(float(*d));
+                    break;
+                default: break;
+            }
+            break;
+        case type_String:
+            switch (value.get_type()) {
+                case type_Int:      return string(std::to_string(value.get_int()));
+                case type_Bool:     return string(value.get_bool() ? "true" : "false");
+                case type_Float:    return string(shortestDouble(value.get_float(), 9));
+                case type_Double:   return string(shortestDouble(value.get_double(), 17));
+                case type_ObjectId: return string(value.get<ObjectId>().to_string());
+                case type_UUID:     return string(value.get<UUID>().to_string());
+                case type_Decimal:  return string(value.get<Decimal128>().to_string());
+                default: break;
+            }
+            break;
+        case type_ObjectId:
+            if (value.is_type(type_String)) {
+                std::string str(value.get_string());
+                if (ObjectId::is_valid_str(str.c_str())) {
+                    return Mixed(ObjectId(str.c_str()));
+                }
+            }
+            break;
+        case type_UUID:
+            if (value.is_type(type_String) && UUID::is_valid_string(value.get_string())) {
+                return Mixed(UUID(value.get_string()));
+            }
+            break;
+        case type_Decimal:
+            switch (value.get_type()) {
+                case type_Int:    return Mixed(Decimal128(value.get_int()));
+                case type_Double: return Mixed(Decimal128(value.get_double()));
+                case type_Float:  return Mixed(Decimal128(double(value.get_float())));
+                case type_String:
+                    if (Decimal128::is_valid_str(value.get_string())) {
+                        return Mixed(Decimal128(value.get_string()));
+                    }
+                    break;
+                default: break;
+            }
+            break;
+        default:
+            break;
+    }
+    return std::nullopt;
+}
+using ConvertFunction = std::function<std::optional<Mixed>(Mixed const&, RLMPropertyType, std::string&)>;
+
+// The objects of a class which were deleted during the migration. An object
+// created during the migration may be given the key of a deleted object, so an
+// object in the new Realm only corresponds to the object with the same key in
+// the old Realm if that key was never deleted.
+struct DeletedObjects {
+    bool all = false;
+    std::set<ObjKey> keys;
+
+    bool contains(ObjKey key) const {
+        return all || keys.count(key);
+    }
+};
+
+// Set `newName` on the objects in the new schema to the converted value of
+// `oldName` on the same object in the old schema. If `includeNewObjects` is
+// set, objects which did not exist before the migration, or all objects if the
+// class had no property named `oldName`, are given a null old value; otherwise
+// they are left unchanged.
+void transformColumn(RLMClassInfo& oldInfo, RLMClassInfo& newInfo, NSString *oldName,
+                     NSString *newName, ConvertFunction const& convert,
+                     DeletedObjects const& deleted, bool includeNewObjects) {
+    NSString *className = newInfo.rlmObjectSchema.className;
+    RLMProperty *newProp = migrationProperty(newInfo, newName, @"new");
+    ColKey oldCol;
+    if (oldInfo.rlmObjectSchema[oldName]) {
+        oldCol = oldInfo.tableColumn(migrationProperty(oldInfo, oldName, @"old"));
+    }
+    ColKey newCol = newInfo.tableColumn(newProp);
+    bool nullable = newProp.optional || newProp.type == RLMPropertyTypeAny;
+
+    auto oldTable = oldInfo.table();
+    std::string buffer;
+    RLMTranslateError([&] {
+        for (auto& obj : *newInfo.table()) {
+            ObjKey key = obj.get_key();
+            bool existed = oldTable->is_valid(key) && !deleted.contains(key);
+            if (!existed && !includeNewObjects) {
+                continue;
+            }
+            Mixed value;
+            if (oldCol && existed) {
+                value = oldTable->get_object(key).get_any(oldCol);
+            }
+            auto converted = convert(value, newProp.type, buffer);
+            if (!converted) {
+                @throw RLMException(@"Cannot convert value '%@' of property '%@.%@' to '%@' for property '%@'.",
+                                    RLMMixedToObjc(value), className, oldName,
+                                    RLMTypeToString(newProp.type), newName);
+            }
+            if (converted->is_null() && !nullable) {
+                @throw RLMException(@"Cannot set non-optional property '%@.%@' to nil when converting from property '%@'.",
+                                    className, newName, oldName);
+            }
+            obj.set_any(newCol, *converted);
+        }
+    });
+}
+
+// Make a Mixed which does not point into memory owned by an Objective-C object,
+// as that memory may be freed when the autorelease pool is drained.
+Mixed ownedMixed(Mixed value, std::string& storage) {
+    if (value.is_type(type_String)) {
+        storage = value.get_string();
+        return StringData(storage);
+    }
+    if (value.is_type(type_Binary)) {
+        storage = std::string(value.get_binary().data(), value.get_binary().size());
+        return BinaryData(storage);
+    }
+    return value;
+}
+} // anonymous namespace
+
+@implementation RLMPropertyConverter {
+@public
+    ConvertFunction _convert;
+}
+
++ (instancetype)typeConversion {
+    RLMPropertyConverter *converter = [self new];
+    converter->_convert = convertMigrationValue;
+    return converter;
+}
+
++ (instancetype)typeConversionWithDefault:(id<RLMValue>)defaultValue {
+    auto storage = std::make_shared<std::string>();
+    Mixed value = ownedMixed(RLMObjcToMixed(defaultValue), *storage);
+    RLMPropertyConverter *converter = [self new];
+    converter->_convert = [=](Mixed const& old, RLMPropertyType type, std::string& buffer) {
+        (void)storage;
+        return convertMigrationValue(old.is_null() ? value : old, type, buffer);
+    };
+    return converter;
+}
+
++ (instancetype)componentSeparatedByString:(NSString *)separator atIndex:(NSUInteger)index {
+    if (!separator.length) {
+        @throw RLMException(@"Separator must not be empty.");
+    }
+    std::string sep = separator.UTF8String;
+    RLMPropertyConverter *converter = [self new];
+    converter->_convert = [=](Mixed const& old, RLMPropertyType type, std::string& buffer) -> std::optional<Mixed> {
+        if (old.is_null()) {
+            return old;
+        }
+        if (!old.is_type(type_String)) {
+            return std::nullopt;
+        }
+        std::string_view str = old.get_string();
+        for (NSUInteger i = 0; i < index; ++i) {
+            size_t pos = str.find(sep);
+            if (pos == str.npos) {
+                return Mixed();
+            }
+            str.remove_prefix(pos + sep.size());
+        }
+        str = str.substr(0, str.find(sep));
+        return convertMigrationValue(StringData(str.data(), str.size()), type, buffer);
+    };
+    return converter;
+}
+
++ (instancetype)converterWithBlock:(RLMPropertyTransformBlock)block {
+    RLMPropertyConverter *converter = [self new];
+    converter->_convert = [=](Mixed const& old, RLMPropertyType type, std::string& buffer) -> std::optional<Mixed> {
+        @autoreleasepool {
+            id value = old.is_null() ? nil : RLMCoerceToNil(migrationValue(old));
+            id result = RLMCoerceToNil(block(value));
+            if (!result) {
+                return Mixed();
+            }
+            // Copy out of the Objective-C object before the pool is drained,
+            // converting numbers to the type of the property
+            std::string storage;
+            auto converted = convertMigrationValue(ownedMixed(RLMObjcToMixed(result), storage), type, buffer);
+            if (converted) {
+                converted = ownedMixed(*converted, buffer);
+            }
+            return converted;
+        }
+    };
+    return converter;
+}
+@end
+
 @implementation RLMMigration {
     RLMRealm *_oldRealm;
     RLMRealm *_realm;
     realm::Schema *_schema;
+    std::map<TableKey, DeletedObjects> _deleted;
 }
 
 - (instancetype)initWithRealm:(RLMRealm *)realm oldRealm:(RLMRealm *)oldRealm schema:(realm::Schema &)schema {
@@ -129,6 +509,136 @@ using namespace realm;
     }
 }
 
+- (void)transformObjects:(NSString *)className
+               batchSize:(NSUInteger)batchSize
+                   block:(RLMObjectTransformBlock)block {
+    if (batchSize == 0) {
+        @throw RLMException(@"Batch size must be greater than zero.");
+    }
+    RLMClassInfo& oldInfo = migrationClassInfo(_oldRealm, className, @"old");
+    RLMClassInfo& newInfo = migrationClassInfo(_realm, className, @"new");
+
+    // Each worker reads from its own copy of the pre-migration read
+    // transaction, as a transaction can't be used from multiple threads
+    size_t workerCount = std::max<size_t>(NSProcessInfo.processInfo.activeProcessorCount, 1);
+    auto& oldTransaction = static_cast<Transaction&>(_oldRealm.group);
+    std::vector<TransactionRef> transactions;
+    for (size_t i = 0; i < workerCount; ++i) {
+        transactions.push_back(oldTransaction.duplicate());
+    }
+
+    auto oldTable = oldInfo.table();
+    auto newTable = newInfo.table();
+    // Don't allocate more space for a batch than there are objects to transform
+    batchSize = std::min<size_t>(batchSize, oldTable->size());
+    auto& deleted = _deleted[newTable->get_key()];
+    TableKey tableKey = oldTable->get_key();
+    RLMClassInfo *oldInfoPtr = &oldInfo;
+    std::vector<ObjKey> keys;
+    keys.reserve(batchSize);
+    std::vector<NSDictionary *> results(batchSize);
+    std::vector<std::exception_ptr> errors(workerCount);
+    std::vector<NSException *> exceptions(workerCount);
+
+    RLMAccessorContext ctx(newInfo);
+    RLMObjectSchema *objectSchema = newInfo.rlmObjectSchema;
+    for (auto it = oldTable->begin(), end = oldTable->end(); it != end;) {
+        keys.clear();
+        for (; it != end && keys.size() < batchSize; ++it) {
+            keys.push_back(it->get_key());
+        }
+
+        // Blocks copy captured C++ objects, so capture pointers to them instead
+        size_t count = keys.size();
+        size_t chunkSize = (count + workerCount - 1) / workerCount;
+        ObjKey const *keysPtr = keys.data();
+        NSDictionary * __strong *resultsPtr = results.data();
+        TransactionRef *transactionsPtr = transactions.data();
+        std::exception_ptr *errorsPtr = errors.data();
+        NSException * __strong *exceptionsPtr = exceptions.data();
+        dispatch_apply(workerCount, DISPATCH_APPLY_AUTO, ^(size_t worker) {
+            try {
+                @try {
+                    auto table = transactionsPtr[worker]->get_table(tableKey);
+                    size_t end = std::min(count, (worker + 1) * chunkSize);
+                    for (size_t i = worker * chunkSize; i < end; ++i) {
+                        @autoreleasepool {
+                            resultsPtr[i] = block(readMigrationValues(table->get_object(keysPtr[i]), *oldInfoPtr));
+                        }
+                    }
+                }
+                @catch (NSException *e) {
+                    exceptionsPtr[worker] = e;
+                }
+            }
+            catch (...) {
+                errorsPtr[worker] = std::current_exception();
+            }
+        });
+        for (size_t i = 0; i < workerCount; ++i) {
+            if (exceptions[i]) {
+                @throw exceptions[i];
+            }
+            if (errors[i]) {
+                RLMTranslateError([&] { std::rethrow_exception(errors[i]); });
+            }
+        }
+
+        // Write the new values in the order the objects were read
+        for (size_t i = 0; i < count; ++i) {
+            @autoreleasepool {
+                NSDictionary *values = results[i];
+                results[i] = nil;
+                if (!values || !newTable->is_valid(keys[i]) || deleted.contains(keys[i])) {
+                    continue;
+                }
+                realm::Object object(_realm->_realm, *newInfo.objectSchema, newTable->get_object(keys[i]));
+                for (NSString *name in values) {
+                    RLMProperty *prop = objectSchema[name];
+                    if (!prop) {
+                        @throw RLMException(@"Invalid property name '%@' for class '%@'.", name, className);
+                    }
+                    id value = RLMCoerceToNil(values[name]);
+                    RLMValidateValueForProperty(value, objectSchema, prop);
+                    RLMTranslateError([&] {
+                        object.set_property_value(ctx, prop.columnName.UTF8String, value ?: NSNull.null);
+                    });
+                }
+            }
+        }
+    }
+}
+
+- (void)copyValuesOfProperty:(NSString *)oldName toProperty:(NSString *)newName
+                     ofClass:(NSString *)className {
+    RLMClassInfo& oldInfo = migrationClassInfo(_oldRealm, className, @"old");
+    RLMClassInfo& newInfo = migrationClassInfo(_realm, className, @"new");
+    migrationProperty(oldInfo, oldName, @"old");
+    // Objects created during the migration have no old value to copy
+    transformColumn(oldInfo, newInfo, oldName, newName, convertMigrationValue,
+                    _deleted[newInfo.table()->get_key()], false);
+}
+
+- (void)transformProperty:(NSString *)propertyName ofClass:(NSString *)className
+                    using:(RLMPropertyTransformBlock)block {
+    [self transformProperty:propertyName ofClass:className toProperty:propertyName
+              withConverter:[RLMPropertyConverter converterWithBlock:block]];
+}
+
+- (void)transformProperty:(NSString *)oldName ofClass:(NSString *)className
+               toProperty:(NSString *)newName using:(RLMPropertyTransformBlock)block {
+    [self transformProperty:oldName ofClass:className toProperty:newName
+              withConverter:[RLMPropertyConverter converterWithBlock:block]];
+}
+
+- (void)transformProperty:(NSString *)oldName ofClass:(NSString *)className
+               toProperty:(NSString *)newName withConverter:(RLMPropertyConverter *)converter {
+    RLMClassInfo& newInfo = migrationClassInfo(_realm, className, @"new");
+    transformColumn(migrationClassInfo(_oldRealm, className, @"old"), newInfo,
+                    oldName, newName, converter->_convert,
+                    _deleted[newInfo.table()->get_key()], true);
+}
+
 - (RLMObject *)createObject:(NSString *)className withValue:(id)value {
     return [_realm createObject:className withValue:value];
 }
@@ -138,7 +648,13 @@ using namespace realm;
 }
 
 - (void)deleteObject:(RLMObject *)object {
+    bool valid = object->_row.is_valid();
+    TableKey table = valid ? object->_row.get_table()->get_key() : TableKey();
+    ObjKey key = valid ? object->_row.get_key() : ObjKey();
     [_realm deleteObject:object];
+    if (valid) {
+        _deleted[table].keys.insert(key);
+    }
 }
 
 - (BOOL)deleteDataForClassName:(NSString *)name {
@@ -152,6 +668,7 @@ using namespace realm;
     }
     if ([_realm.schema schemaForClassName:name]) {
         table->clear();
+        _deleted[table->get_key()].all = true;
     }
     else {
         _realm.group.remove_table(table->get_key());
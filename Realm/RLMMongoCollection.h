@@ -21,7 +21,7 @@
 RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
 @protocol RLMBSON;
 
-@class RLMFindOptions, RLMFindOneAndModifyOptions, RLMUpdateResult, RLMChangeStream, RLMObjectId;
+@class RLMFindOptions, RLMFindOneAndModifyOptions, RLMUpdateResult, RLMChangeStream, RLMObjectId, RLMBSONArrayView;
 
 /// Delegate which is used for subscribing to changes on a `[RLMMongoCollection watch]` stream.
 @protocol RLMChangeEventDelegate
@@ -78,6 +78,10 @@ typedef void(^RLMMongoInsertManyBlock)(NSArray<id<RLMBSON>> * _Nullable, NSError
 RLM_SWIFT_SENDABLE // invoked on a background thread
 typedef void(^RLMMongoFindBlock)(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> * _Nullable,
                                  NSError * _Nullable);
+/// Block which returns a lazily converted view of an array of Documents on a successful find operation,
+/// or an error should one occur.
+RLM_SWIFT_SENDABLE // invoked on a background thread
+typedef void(^RLMMongoFindViewBlock)(RLMBSONArrayView * _Nullable, NSError * _Nullable);
 /// Block which returns a Document on a successful findOne operation, or an error should one occur.
 RLM_SWIFT_SENDABLE // invoked on a background thread
 typedef void(^RLMMongoFindOneBlock)(NSDictionary<NSString *, id<RLMBSON>> * _Nullable_result,
@@ -124,6 +128,19 @@ typedef void(^RLMMongoDeleteBlock)(NSDictionary<NSString *, id<RLMBSON>> * _Null
 - (void)findWhere:(NSDictionary<NSString *, id<RLMBSON>> *)filterDocument
        completion:(RLMMongoFindBlock)completion NS_REFINED_FOR_SWIFT;
 
+/// Finds the documents in this collection which match the provided filter,
+/// without converting them to dictionaries.
+///
+/// Each value in the resulting documents is only converted when it is read
+/// from the view, which is much faster than `findWhere:options:completion:`
+/// when only some fields of each document are needed.
+/// @param filterDocument A `Document` as bson that should match the query.
+/// @param options `RLMFindOptions` to use when executing the command.
+/// @param completion A view of the resulting bson array of documents or error if one occurs
+- (void)findDocumentViewsWhere:(NSDictionary<NSString *, id<RLMBSON>> *)filterDocument
+                       options:(RLMFindOptions *)options
+                    completion:(RLMMongoFindViewBlock)completion NS_REFINED_FOR_SWIFT;
+
 /// Returns one document from a collection or view which matches the
 /// provided filter. If multiple documents satisfy the query, this method
 /// returns the first document according to the query's sort order or natural
@@ -150,6 +167,13 @@ typedef void(^RLMMongoDeleteBlock)(NSDictionary<NSString *, id<RLMBSON>> * _Null
 - (void)aggregateWithPipeline:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)pipeline
                    completion:(RLMMongoFindBlock)completion NS_REFINED_FOR_SWIFT;
 
+/// Runs an aggregation framework pipeline against this collection, without
+/// converting the resulting documents to dictionaries.
+/// @param pipeline A bson array made up of `Documents` containing the pipeline of aggregation operations to perform.
+/// @param completion A view of the resulting bson array of documents or error if one occurs
+- (void)aggregateDocumentViewsWithPipeline:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)pipeline
+                                completion:(RLMMongoFindViewBlock)completion NS_REFINED_FOR_SWIFT;
+
 /// Counts the number of documents in this collection matching the provided filter.
 /// @param filterDocument A `Document` as bson that should match the query.
 /// @param limit The max amount of documents to count
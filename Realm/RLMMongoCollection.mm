@@ -152,6 +152,20 @@ __attribute__((objc_direct_members))
     [self findWhere:document options:[[RLMFindOptions alloc] init] completion:completion];
 }
 
+- (void)findDocumentViewsWhere:(NSDictionary<NSString *, id<RLMBSON>> *)document
+                       options:(RLMFindOptions *)options
+                    completion:(RLMMongoFindViewBlock)completion {
+    self.collection.find(toBsonDocument(document), [options _findOptions],
+                         [completion](std::optional<realm::bson::BsonArray> documents,
+                                      std::optional<realm::app::AppError> error) {
+        if (error) {
+            return completion(nil, makeError(*error));
+        }
+        auto array = std::make_shared<const realm::bson::BsonArray>(std::move(*documents));
+        completion([[RLMBSONArrayView alloc] initWithArray:std::move(array)], nil);
+    });
+}
+
 - (void)findOneDocumentWhere:(NSDictionary<NSString *, id<RLMBSON>> *)document
                      options:(RLMFindOptions *)options
                   completion:(RLMMongoFindOneBlock)completion {
@@ -214,6 +228,19 @@ __attribute__((objc_direct_members))
     });
 }
 
+- (void)aggregateDocumentViewsWithPipeline:(NSArray<NSDictionary<NSString *, id<RLMBSON>> *> *)pipeline
+                                completion:(RLMMongoFindViewBlock)completion {
+    self.collection.aggregate(toBsonArray(pipeline),
+                              [completion](std::optional<realm::bson::BsonArray> documents,
+                                           std::optional<realm::app::AppError> error) {
+        if (error) {
+            return completion(nil, makeError(*error));
+        }
+        auto array = std::make_shared<const realm::bson::BsonArray>(std::move(*documents));
+        completion([[RLMBSONArrayView alloc] initWithArray:std::move(array)], nil);
+    });
+}
+
 - (void)countWhere:(NSDictionary<NSString *, id<RLMBSON>> *)document
              limit:(NSInteger)limit
         completion:(RLMMongoCountBlock)completion {
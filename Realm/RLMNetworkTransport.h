@@ -51,8 +51,18 @@ typedef RLM_CLOSED_ENUM(int32_t, RLMHTTPMethod) {
 @property (nonatomic, strong) NSDictionary<NSString *, NSString *>* headers;
 
 /// The body of the request.
+///
+/// Setting this replaces `bodyData`. If the body was instead set as data, this
+/// is that data decoded as UTF-8.
 @property (nonatomic, strong) NSString* body;
 
+/// The raw bytes of the body of the request.
+///
+/// Setting this replaces `body`. Transports should prefer reading the body
+/// from this property, as it avoids decoding and re-encoding the body as a
+/// string. Requests created by the SDK always set the body as data.
+@property (nonatomic, strong, nullable) NSData *bodyData;
+
 @end
 
 /// The contents of an HTTP response.
@@ -68,8 +78,17 @@ typedef RLM_CLOSED_ENUM(int32_t, RLMHTTPMethod) {
 @property (nonatomic, strong) NSDictionary<NSString *, NSString *>* headers;
 
 /// The body of the HTTP response.
+///
+/// Setting this replaces `bodyData`. If the body was instead set as data, this
+/// is that data decoded as UTF-8 the first time it is read.
 @property (nonatomic, strong) NSString *body;
 
+/// The raw bytes of the body of the HTTP response.
+///
+/// Setting this replaces `body`. Transports should prefer setting the body as
+/// data, as the SDK then uses the bytes as-is rather than encoding a string.
+@property (nonatomic, strong, nullable) NSData *bodyData;
+
 @end
 
 /// Delegate which is used for subscribing to changes.
@@ -115,9 +134,36 @@ RLM_SWIFT_SENDABLE // used from multiple threads so must be internally thread-sa
 
 /// Transporting protocol for foreign interfaces. Allows for custom
 /// request/response handling.
+///
+/// All requests sent through a transport share a single long-lived
+/// `NSURLSession`, so connections to the server (and their TLS sessions) are
+/// reused between requests, and concurrent requests are multiplexed over a
+/// single connection when the server supports HTTP/2.
 RLM_SWIFT_SENDABLE // is internally thread-safe
 @interface RLMNetworkTransport : NSObject<RLMNetworkTransport>
 
+/**
+ Creates a transport whose session uses the default session configuration.
+ */
+- (instancetype)init;
+
+/**
+ Creates a transport whose session uses the given configuration.
+
+ This can be used to customize connection handling, such as the maximum
+ number of simultaneous connections to each host via
+ `HTTPMaximumConnectionsPerHost`, or whether HTTP/1.1 requests are pipelined
+ via `HTTPShouldUsePipelining`.
+
+ @param configuration The configuration to create the session with. The
+                      configuration is copied, so modifying it after
+                      creating the transport has no effect.
+ */
+- (instancetype)initWithSessionConfiguration:(NSURLSessionConfiguration *)configuration;
+
+/// A copy of the configuration used to create the transport's session.
+@property (nonatomic, readonly) NSURLSessionConfiguration *sessionConfiguration;
+
 /**
  Sends a request to a given endpoint.
 
@@ -28,6 +28,9 @@
 #import <realm/object-store/sync/generic_network_transport.hpp>
 #import <realm/util/scope_exit.hpp>
 
+#import <mutex>
+#import <unordered_map>
+
 using namespace realm;
 
 static_assert((int)RLMHTTPMethodGET        == (int)app::HttpMethod::get);
@@ -36,12 +39,6 @@ static_assert((int)RLMHTTPMethodPUT        == (int)app::HttpMethod::put);
 static_assert((int)RLMHTTPMethodPATCH      == (int)app::HttpMethod::patch);
 static_assert((int)RLMHTTPMethodDELETE     == (int)app::HttpMethod::del);
 
-#pragma mark RLMSessionDelegate
-
-@interface RLMSessionDelegate <NSURLSessionDelegate> : NSObject
-+ (instancetype)delegateWithCompletion:(RLMNetworkTransportCompletionBlock)completion;
-@end
-
 NSString * const RLMHTTPMethodToNSString[] = {
     [RLMHTTPMethodGET] = @"GET",
     [RLMHTTPMethodPOST] = @"POST",
@@ -50,40 +47,195 @@ NSString * const RLMHTTPMethodToNSString[] = {
     [RLMHTTPMethodDELETE] = @"DELETE"
 };
 
-@implementation RLMRequest
+// RLMRequest and RLMResponse store the body as whichever of a string or data
+// it was last set as, and convert it to the other only when it is read.
+@implementation RLMRequest {
+    NSData *_bodyData;
+}
+
+@synthesize body = _body;
+
+- (NSString *)body {
+    if (!_body && _bodyData) {
+        _body = [[NSString alloc] initWithData:_bodyData encoding:NSUTF8StringEncoding];
+    }
+    return _body;
+}
+
+- (void)setBody:(NSString *)body {
+    _body = body;
+    _bodyData = nil;
+}
+
+- (NSData *)bodyData {
+    if (!_bodyData && _body) {
+        _bodyData = [_body dataUsingEncoding:NSUTF8StringEncoding];
+    }
+    return _bodyData;
+}
+
+- (void)setBodyData:(NSData *)bodyData {
+    _bodyData = bodyData;
+    _body = nil;
+}
+@end
+
+@implementation RLMResponse {
+    NSData *_bodyData;
+}
+
+@synthesize body = _body;
+
+- (NSString *)body {
+    if (!_body && _bodyData) {
+        _body = [[NSString alloc] initWithData:_bodyData encoding:NSUTF8StringEncoding];
+    }
+    return _body;
+}
+
+- (void)setBody:(NSString *)body {
+    _body = body;
+    _bodyData = nil;
+}
+
+- (NSData *)bodyData {
+    if (!_bodyData && _body) {
+        _bodyData = [_body dataUsingEncoding:NSUTF8StringEncoding];
+    }
+    return _bodyData;
+}
+
+- (void)setBodyData:(NSData *)bodyData {
+    _bodyData = bodyData;
+    _body = nil;
+}
 @end
 
-@implementation RLMResponse
+#pragma mark RLMSessionDelegate
+
+typedef void (^RLMSessionTaskCompletion)(NSHTTPURLResponse *, NSError *, std::string&& body);
+
+// The delegate of the transport's shared session, which accumulates the body
+// of each in-flight task directly into a std::string
+@interface RLMSessionDelegate : NSObject <NSURLSessionDataDelegate>
+- (void)resumeTask:(NSURLSessionDataTask *)task completion:(RLMSessionTaskCompletion)completion;
 @end
 
 @interface RLMEventSessionDelegate <NSURLSessionDelegate> : NSObject
 + (instancetype)delegateWithEventSubscriber:(id<RLMEventDelegate>)subscriber;
 @end;
 
-@implementation RLMNetworkTransport
-
-- (void)sendRequestToServer:(RLMRequest *)request
-                 completion:(RLMNetworkTransportCompletionBlock)completionBlock {
-    // Create the request
-    NSURL *requestURL = [[NSURL alloc] initWithString: request.url];
+static NSMutableURLRequest *makeURLRequest(NSString *url, RLMHTTPMethod method,
+                                           NSTimeInterval timeout, NSData *body) {
+    NSURL *requestURL = [[NSURL alloc] initWithString:url];
     NSMutableURLRequest *urlRequest = [NSMutableURLRequest requestWithURL:requestURL];
-    urlRequest.HTTPMethod = RLMHTTPMethodToNSString[request.method];
-    if (![urlRequest.HTTPMethod isEqualToString:@"GET"]) {
-        urlRequest.HTTPBody = [request.body dataUsingEncoding:NSUTF8StringEncoding];
+    urlRequest.HTTPMethod = RLMHTTPMethodToNSString[method];
+    if (method != RLMHTTPMethodGET) {
+        urlRequest.HTTPBody = body;
     }
-    urlRequest.timeoutInterval = request.timeout;
+    urlRequest.timeoutInterval = timeout;
+    return urlRequest;
+}
+
+// Wrap the string in an NSData without copying the bytes
+static NSData *dataFromString(std::string&& str) {
+    auto owned = new std::string(std::move(str));
+    return [[NSData alloc] initWithBytesNoCopy:owned->data() length:owned->size()
+                                   deallocator:^(void *, NSUInteger) { delete owned; }];
+}
 
+bool RLMTransportSupportsAppRequests(id<RLMNetworkTransport> transport) {
+    static IMP sendRequest = [RLMNetworkTransport instanceMethodForSelector:@selector(sendRequestToServer:completion:)];
+    return [transport isKindOfClass:[RLMNetworkTransport class]]
+        && [(id)transport methodForSelector:@selector(sendRequestToServer:completion:)] == sendRequest;
+}
+
+@implementation RLMNetworkTransport {
+    NSURLSession *_session;
+    RLMSessionDelegate *_delegate;
+}
+
+- (instancetype)init {
+    return [self initWithSessionConfiguration:NSURLSessionConfiguration.defaultSessionConfiguration];
+}
+
+- (instancetype)initWithSessionConfiguration:(NSURLSessionConfiguration *)configuration {
+    if (self = [super init]) {
+        // The session retains its delegate but not the transport, so there's
+        // no cycle. Delegate methods are invoked on the session's serial
+        // delegate queue, which is fine as they just hand the response off.
+        _delegate = [RLMSessionDelegate new];
+        _session = [NSURLSession sessionWithConfiguration:configuration
+                                                 delegate:_delegate
+                                            delegateQueue:nil];
+    }
+    return self;
+}
+
+- (void)dealloc {
+    // Let any requests which are in flight finish, then release the
+    // session's connections
+    [_session finishTasksAndInvalidate];
+}
+
+- (NSURLSessionConfiguration *)sessionConfiguration {
+    return [_session.configuration copy];
+}
+
+- (void)sendRequestToServer:(RLMRequest *)request
+                 completion:(RLMNetworkTransportCompletionBlock)completionBlock {
+    NSMutableURLRequest *urlRequest = makeURLRequest(request.url, request.method,
+                                                     request.timeout, request.bodyData);
     for (NSString *key in request.headers) {
         [urlRequest addValue:request.headers[key] forHTTPHeaderField:key];
     }
-    id delegate = [RLMSessionDelegate delegateWithCompletion:completionBlock];
-    auto session = [NSURLSession sessionWithConfiguration:NSURLSessionConfiguration.defaultSessionConfiguration
-                                                 delegate:delegate delegateQueue:nil];
 
-    // Add the request to a task and start it
-    [[session dataTaskWithRequest:urlRequest] resume];
-    // Tell the session to destroy itself once it's done with the request
-    [session finishTasksAndInvalidate];
+    // Add the request to a task on the shared session and start it
+    [_delegate resumeTask:[_session dataTaskWithRequest:urlRequest]
+               completion:^(NSHTTPURLResponse *httpResponse, NSError *error, std::string&& body) {
+        RLMResponse *response = [RLMResponse new];
+        response.headers = httpResponse.allHeaderFields;
+        response.httpStatusCode = httpResponse.statusCode;
+        if (error) {
+            response.body = error.localizedDescription;
+            response.customStatusCode = error.code;
+        }
+        else {
+            response.bodyData = dataFromString(std::move(body));
+        }
+        completionBlock(response);
+    }];
+}
+
+- (void)sendAppRequest:(app::Request const&)request
+            completion:(util::UniqueFunction<void(app::Response const&)>&&)completion {
+    NSData *body = [NSData dataWithBytes:request.body.data() length:request.body.size()];
+    NSMutableURLRequest *urlRequest = makeURLRequest(@(request.url.c_str()),
+                                                     static_cast<RLMHTTPMethod>(request.method),
+                                                     request.timeout_ms / 1000.0, body);
+    for (auto& [key, value] : request.headers) {
+        [urlRequest addValue:@(value.c_str()) forHTTPHeaderField:@(key.c_str())];
+    }
+
+    auto completion_ptr = completion.release();
+    [_delegate resumeTask:[_session dataTaskWithRequest:urlRequest]
+               completion:^(NSHTTPURLResponse *httpResponse, NSError *error, std::string&& body) {
+        util::UniqueFunction<void(const app::Response&)> completion(completion_ptr);
+        app::Response response{
+            .http_status_code = static_cast<int>(httpResponse.statusCode),
+        };
+        [httpResponse.allHeaderFields enumerateKeysAndObjectsUsingBlock:[&](NSString *key, NSString *value, BOOL *) {
+            response.headers[key.UTF8String] = value.UTF8String;
+        }];
+        if (error) {
+            response.custom_status_code = static_cast<int>(error.code);
+            response.body = error.localizedDescription.UTF8String;
+        }
+        else {
+            response.body = std::move(body);
+        }
+        completion(response);
+    }];
 }
 
 - (NSURLSession *)doStreamRequest:(nonnull RLMRequest *)request
@@ -115,7 +267,7 @@ RLMRequest *RLMRequestFromRequest(realm::app::Request const& request) {
     rlmRequest.method = static_cast<RLMHTTPMethod>(request.method);
     rlmRequest.timeout = request.timeout_ms;
     rlmRequest.url = @(request.url.c_str());
-    rlmRequest.body = @(request.body.c_str());
+    rlmRequest.bodyData = [NSData dataWithBytes:request.body.data() length:request.body.size()];
     return rlmRequest;
 }
 
@@ -123,48 +275,71 @@ RLMRequest *RLMRequestFromRequest(realm::app::Request const& request) {
 
 #pragma mark RLMSessionDelegate
 
+namespace {
+struct SessionTask {
+    RLMSessionTaskCompletion completion;
+    std::string body;
+};
+} // anonymous namespace
+
 @implementation RLMSessionDelegate {
-    NSData *_data;
-    RLMNetworkTransportCompletionBlock _completionBlock;
+    std::mutex _mutex;
+    std::unordered_map<NSUInteger, SessionTask> _tasks;
 }
 
-+ (instancetype)delegateWithCompletion:(RLMNetworkTransportCompletionBlock)completion {
-    RLMSessionDelegate *delegate = [RLMSessionDelegate new];
-    delegate->_completionBlock = completion;
-    return delegate;
+- (void)resumeTask:(NSURLSessionDataTask *)task completion:(RLMSessionTaskCompletion)completion {
+    {
+        std::lock_guard lock(_mutex);
+        _tasks[task.taskIdentifier].completion = completion;
+    }
+    [task resume];
+}
+
+- (void)URLSession:(__unused NSURLSession *)session
+          dataTask:(NSURLSessionDataTask *)dataTask
+didReceiveResponse:(NSURLResponse *)response
+ completionHandler:(void (^)(NSURLSessionResponseDisposition))completionHandler {
+    // Reserve space for the entire body up front when the server tells us how
+    // big it is so that large responses aren't repeatedly reallocated
+    if (response.expectedContentLength > 0) {
+        std::lock_guard lock(_mutex);
+        if (auto it = _tasks.find(dataTask.taskIdentifier); it != _tasks.end()) {
+            it->second.body.reserve(static_cast<size_t>(response.expectedContentLength));
+        }
+    }
+    completionHandler(NSURLSessionResponseAllow);
 }
 
 - (void)URLSession:(__unused NSURLSession *)session
-          dataTask:(__unused NSURLSessionDataTask *)dataTask
+          dataTask:(NSURLSessionDataTask *)dataTask
     didReceiveData:(NSData *)data {
-    if (!_data) {
-        _data = data;
+    std::lock_guard lock(_mutex);
+    auto it = _tasks.find(dataTask.taskIdentifier);
+    if (it == _tasks.end()) {
         return;
     }
-    if (![_data respondsToSelector:@selector(appendData:)]) {
-        _data = [_data mutableCopy];
-    }
-    [(id)_data appendData:data];
+    auto& body = it->second.body;
+    // The data may be made up of several discontiguous buffers, so append
+    // each of them rather than using `bytes`, which would flatten it first
+    [data enumerateByteRangesUsingBlock:[&](const void *bytes, NSRange range, BOOL *) {
+        body.append(static_cast<const char *>(bytes), range.length);
+    }];
 }
 
 - (void)URLSession:(__unused NSURLSession *)session
               task:(NSURLSessionTask *)task
-didCompleteWithError:(NSError *)error
-{
-    RLMResponse *response = [RLMResponse new];
-    NSHTTPURLResponse *httpResponse = (NSHTTPURLResponse *) task.response;
-    response.headers = httpResponse.allHeaderFields;
-    response.httpStatusCode = httpResponse.statusCode;
-
-    if (error) {
-        response.body = error.localizedDescription;
-        response.customStatusCode = error.code;
-        return _completionBlock(response);
+didCompleteWithError:(NSError *)error {
+    SessionTask state;
+    {
+        std::lock_guard lock(_mutex);
+        auto it = _tasks.find(task.taskIdentifier);
+        if (it == _tasks.end()) {
+            return;
+        }
+        state = std::move(it->second);
+        _tasks.erase(it);
     }
-
-    response.body = [[NSString alloc] initWithData:_data encoding:NSUTF8StringEncoding];
-
-    _completionBlock(response);
+    state.completion((NSHTTPURLResponse *)task.response, error, std::move(state.body));
 }
 
 @end
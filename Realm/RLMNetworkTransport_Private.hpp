@@ -18,8 +18,22 @@
 
 #import "RLMNetworkTransport.h"
 
-namespace realm::app {
-struct Request;
-}
+#import <realm/object-store/sync/generic_network_transport.hpp>
+
+RLM_HEADER_AUDIT_BEGIN(nullability)
+
+@interface RLMNetworkTransport ()
+// Send a request made by core without converting it to an RLMRequest. The
+// response body is received directly into the string passed to the
+// completion rather than being accumulated in an NSData and then copied.
+- (void)sendAppRequest:(realm::app::Request const&)request
+            completion:(realm::util::UniqueFunction<void(realm::app::Response const&)>&&)completion;
+@end
+
+// Check if core's requests can be sent with -sendAppRequest:completion:,
+// which is the case if the transport does not override -sendRequestToServer:.
+bool RLMTransportSupportsAppRequests(id<RLMNetworkTransport> transport);
 
 RLMRequest *RLMRequestFromRequest(realm::app::Request const& request);
+
+RLM_HEADER_AUDIT_END(nullability)
@@ -418,6 +418,23 @@ RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
  */
 + (NSArray<NSString *> *)requiredProperties;
 
+/**
+ Override this method to specify the names of string properties whose values
+ should be interned.
+
+ Reading a string property normally creates a new `NSString` each time. For
+ properties with a small number of distinct values, such as a status or a
+ country code, interning makes repeated reads of the same value return the
+ same `NSString` instance from a bounded per-property cache, which avoids the
+ allocation and makes `isEqual:` checks between the values cheap. Values which
+ don't fit in the cache are read normally.
+
+ Only non-collection string properties can be interned.
+
+ @return    An array of property names to intern.
+ */
++ (NSArray<NSString *> *)internedStringProperties;
+
 /**
  Override this method to provide information related to properties containing linking objects.
 
@@ -698,6 +715,48 @@ typedef void (^RLMObjectChangeBlock)(BOOL deleted,
  */
 - (RLMNotificationToken *)addNotificationBlock:(RLMObjectChangeBlock)block keyPaths:(NSArray<NSString *> *)keyPaths;
 
+/**
+ A callback block for notifications registered with
+ `+addNotificationBlock:toObjects:keyPaths:queue:`.
+
+ `index` is the index of the changed object in the array of objects which was
+ passed when registering. The other arguments have the same meaning as for
+ `RLMObjectChangeBlock`.
+ */
+typedef void (^RLMObjectsChangeBlock)(NSUInteger index,
+                                      BOOL deleted,
+                                      NSArray<RLMPropertyChange *> *_Nullable changes,
+                                      NSError *_Nullable error);
+
+/**
+ Registers a block to be called each time any of the given objects change.
+
+ This is equivalent to calling `-addNotificationBlock:keyPaths:queue:` on each
+ of the objects, but resolves all of the objects on the target queue at once
+ rather than handing each one over separately, which makes registering a large
+ number of observers significantly faster.
+
+ One token is returned for each object, in the same order as `objects`.
+ Invalidating a token stops notifications for only that object.
+
+ @warning This method cannot be called during a write transaction, when the
+          containing Realm is read-only, or with unmanaged objects.
+ @warning All of the objects must be managed by the same Realm.
+ @warning The queue must be a serial queue.
+
+ @param block The block to be called whenever a change occurs.
+ @param objects The objects to observe.
+ @param keyPaths The block will be called for changes occurring on these keypaths. If no
+ key paths are given, notifications are delivered for every property key path.
+ @param queue The serial queue to deliver notifications to.
+ @return Tokens which must be held for as long as you want updates to be delivered.
+ */
++ (NSArray<RLMNotificationToken *> *)addNotificationBlock:(RLMObjectsChangeBlock)block
+                                                toObjects:(NSArray<RLMObject *> *)objects
+                                                 keyPaths:(nullable NSArray<NSString *> *)keyPaths
+                                                    queue:(dispatch_queue_t)queue
+    NS_SWIFT_NAME(addNotificationBlock(_:to:keyPaths:queue:));
+
 
 #pragma mark - Other Instance Methods
 
@@ -716,6 +775,27 @@ typedef void (^RLMObjectChangeBlock)(BOOL deleted,
  */
 - (BOOL)isEqualToObject:(RLMObject *)object;
 
+/**
+ Calls the block with a pointer to the stored value of a string or data
+ property, without copying it into an `NSString` or `NSData`.
+
+ For managed objects the pointer refers directly to the data in the Realm file.
+ It is only valid until the block returns, and the Realm will not be
+ automatically refreshed while the block is running. The block must not
+ refresh the Realm, begin or commit a write transaction, or modify the object,
+ as any of these may invalidate the pointer. String values are passed as UTF-8
+ and are not null-terminated.
+
+ This is intended for reading large string or data values, such as serialized
+ documents, where copying the value on every read is expensive.
+
+ @param propertyName The name of a string or data property of the object.
+ @param block        A block which is called with a pointer to the value and
+                     its length in bytes, or `NULL` and 0 if the value is `nil`.
+ */
+- (void)withUnsafeBytesForProperty:(NSString *)propertyName
+                             block:(__attribute__((noescape)) void (^)(const void *_Nullable bytes, NSUInteger length))block;
+
 /**
  Returns a frozen (immutable) snapshot of this object.
 
@@ -778,6 +858,44 @@ typedef void (^RLMObjectChangeBlock)(BOOL deleted,
 @property (nonatomic, readonly, strong, nullable) id value;
 @end
 
+/**
+ A reusable set of key paths for filtering change notifications.
+
+ The key paths passed to a notification registration method are resolved
+ against the schema each time a notification block is added. Resolved key paths
+ are cached, and an `RLMKeyPathFilter` can be created once and passed as the
+ `keyPaths` argument of any registration method to also skip building the cache
+ key on each registration. This is useful when many observers with the same
+ filter are added and removed repeatedly, such as for cells in a list.
+
+ `RLMKeyPathFilter` is an immutable array of the key paths, and may be shared
+ between threads and used with any type which has the given key paths.
+ */
+RLM_SWIFT_SENDABLE
+@interface RLMKeyPathFilter : NSArray<NSString *>
+
+/**
+ Creates a filter for the given key paths.
+
+ @param keyPaths The key paths to filter on, in the same format as the
+                 `keyPaths` argument of the notification registration methods.
+ */
+- (instancetype)initWithKeyPaths:(NSArray<NSString *> *)keyPaths NS_DESIGNATED_INITIALIZER;
+
+/**
+ Creates a filter for the given key paths.
+ */
++ (instancetype)filterWithKeyPaths:(NSArray<NSString *> *)keyPaths;
+
+/// :nodoc:
+- (instancetype)init NS_UNAVAILABLE;
+/// :nodoc:
+- (instancetype)initWithObjects:(NSString *const _Nonnull [_Nullable])objects count:(NSUInteger)cnt NS_UNAVAILABLE;
+/// :nodoc:
+- (nullable instancetype)initWithCoder:(NSCoder *)coder NS_UNAVAILABLE;
+
+@end
+
 #pragma mark - RLMArray Property Declaration
 
 /**
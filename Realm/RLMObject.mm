@@ -152,6 +152,11 @@
     return [object isKindOfClass:RLMObject.class] && RLMObjectBaseAreEqual(self, object);
 }
 
+- (void)withUnsafeBytesForProperty:(NSString *)propertyName
+                             block:(void (^)(const void *, NSUInteger))block {
+    RLMObjectBaseWithUnsafeBytes(self, propertyName, block);
+}
+
 - (instancetype)freeze {
     return RLMObjectFreeze(self);
 }
@@ -185,6 +190,13 @@
 
 }
 
++ (NSArray<RLMNotificationToken *> *)addNotificationBlock:(RLMObjectsChangeBlock)block
+                                                toObjects:(NSArray<RLMObject *> *)objects
+                                                 keyPaths:(NSArray<NSString *> *)keyPaths
+                                                    queue:(dispatch_queue_t)queue {
+    return RLMObjectAddNotificationBlocks(objects, block, keyPaths, queue);
+}
+
 + (NSString *)className {
     return [super className];
 }
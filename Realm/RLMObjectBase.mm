@@ -38,6 +38,8 @@
 #import <realm/object-store/object_schema.hpp>
 #import <realm/object-store/shared_realm.hpp>
 
+#import <optional>
+
 const NSUInteger RLMDescriptionMaxDepth = 5;
 
 static bool isManagedAccessorClass(Class cls) {
@@ -69,7 +71,14 @@ static void maybeInitObjectSchemaForUnmanaged(RLMObjectBase *obj) {
     object_setClass(obj, obj->_objectSchema.unmanagedClass);
 }
 
-@interface RLMObjectBase () <RLMThreadConfined, RLMThreadConfined_Private>
+@interface RLMObjectBase () <RLMThreadConfined, RLMThreadConfined_Private> {
+    // The hash of the primary key of a managed object, cached so that the
+    // hash does not change when the object is deleted. Accessors reused by
+    // enumeration are pointed at a different row without being recreated, so
+    // the key of the row the hash was computed for is stored with it.
+    std::optional<NSUInteger> _primaryKeyHash;
+    realm::ObjKey _primaryKeyHashRow;
+}
 @end
 
 @implementation RLMObjectBase
@@ -299,23 +308,65 @@ id RLMCreateManagedAccessor(Class cls, RLMClassInfo *info) {
     return _info && !_row.is_valid();
 }
 
+// Equality for two managed objects. Unlike RLMObjectBaseAreEqual() this skips
+// the type checks and nil handling since the caller has already done them.
+static bool RLMManagedObjectsAreEqual(RLMObjectBase *o1, RLMObjectBase *o2) {
+    return o1->_realm == o2->_realm
+        && o1->_row.get_key() == o2->_row.get_key()
+        && o1->_row.is_valid() && o2->_row.is_valid()
+        && o1->_row.get_table() == o2->_row.get_table();
+}
+
+// Hash the primary key value without going through KVC for managed objects.
+// Unmanaged objects convert their value to the same representation so that
+// the hash does not change when the object is added to a Realm.
+static NSUInteger RLMPrimaryKeyHash(RLMObjectBase *obj, RLMProperty *primaryKey) {
+    if (obj->_info) {
+        if (!obj->_primaryKeyHash || obj->_primaryKeyHashRow != obj->_row.get_key()) {
+            if (!obj->_row.is_valid()) {
+                // The primary key can't be read after the object is deleted,
+                // but an object which was never hashed can't be in a hashed
+                // collection either
+                return static_cast<NSUInteger>(obj->_row.get_key().value);
+            }
+            obj->_primaryKeyHash = obj->_row.get_any(obj->_info->tableColumn(primaryKey)).hash();
+            obj->_primaryKeyHashRow = obj->_row.get_key();
+        }
+        return *obj->_primaryKeyHash;
+    }
+    id value = RLMCoerceToNil([obj valueForKey:primaryKey.name]);
+    if (!value) {
+        return realm::Mixed().hash();
+    }
+    if (primaryKey.type == RLMPropertyTypeInt) {
+        // Swift Int8 values of 0 and 1 are boxed as NSNumbers which
+        // RLMObjcToMixed() would convert to bools
+        return realm::Mixed(static_cast<int64_t>([value longLongValue])).hash();
+    }
+    return RLMObjcToMixed(value).hash();
+}
+
 - (BOOL)isEqual:(id)object {
     if (RLMObjectBase *other = RLMDynamicCast<RLMObjectBase>(object)) {
         if (_objectSchema.primaryKeyProperty || _realm.isFrozen) {
-            return RLMObjectBaseAreEqual(self, other);
+            if (self == other) {
+                return YES;
+            }
+            if (!_realm || !other->_realm) {
+                return NO;
+            }
+            return RLMManagedObjectsAreEqual(self, other);
         }
     }
     return [super isEqual:object];
 }
 
 - (NSUInteger)hash {
-    if (_objectSchema.primaryKeyProperty) {
+    if (RLMProperty *primaryKey = _objectSchema.primaryKeyProperty) {
         // If we have a primary key property, that's an immutable value which we
         // can use as the identity of the object.
-        id primaryProperty = [self valueForKey:_objectSchema.primaryKeyProperty.name];
-
         // modify the hash of our primary key value to avoid potential (although unlikely) collisions
-        return [primaryProperty hash] ^ 1;
+        return RLMPrimaryKeyHash(self, primaryKey) ^ 1;
     }
     else if (_realm.isFrozen) {
         // The object key can never change for frozen objects, so that's usable
@@ -334,6 +385,10 @@ id RLMCreateManagedAccessor(Class cls, RLMClassInfo *info) {
     return RLMIsObjectSubclass(self);
 }
 
++ (NSArray *)internedStringProperties {
+    return @[];
+}
+
 + (NSString *)primaryKey {
     return nil;
 }
@@ -494,13 +549,68 @@ BOOL RLMObjectBaseAreEqual(RLMObjectBase *o1, RLMObjectBase *o2) {
     if (o1->_realm == nil || o1->_realm != o2->_realm) {
         return NO;
     }
-    // if either are detached
-    if (!o1->_row.is_valid() || !o2->_row.is_valid()) {
-        return NO;
+    // if either are detached, or the table and key differ
+    return RLMManagedObjectsAreEqual(o1, o2);
+}
+
+bool RLMObjectBaseGetIdentity(RLMObjectBase *obj, RLMObjectIdentity *identity) {
+    if (!obj->_realm) {
+        return false;
+    }
+    identity->tableKey = obj->_info->objectSchema->table_key.value;
+    identity->objectKey = obj->_row.get_key().value;
+    return true;
+}
+
+void RLMObjectBaseWithUnsafeBytes(RLMObjectBase *obj, NSString *propertyName,
+                                  void (NS_NOESCAPE ^block)(const void *, NSUInteger)) {
+    RLMProperty *prop = obj->_objectSchema[propertyName];
+    if (!prop) {
+        @throw RLMException(@"Invalid property name '%@' for class '%@'.",
+                            propertyName, obj->_objectSchema.className);
+    }
+    if (prop.collection || (prop.type != RLMPropertyTypeString && prop.type != RLMPropertyTypeData)) {
+        @throw RLMException(@"Property '%@' on '%@' is of type '%@': only string and data properties can be read as bytes.",
+                            propertyName, obj->_objectSchema.className, RLMTypeToString(prop.type));
+    }
+
+    if (!obj->_realm) {
+        id value = RLMCoerceToNil([obj valueForKey:propertyName]);
+        if (!value) {
+            block(nullptr, 0);
+        }
+        else if (prop.type == RLMPropertyTypeString) {
+            realm::StringData str = RLMStringDataWithNSString(value);
+            block(str.data(), str.size());
+        }
+        else {
+            block([value bytes], [value length]);
+        }
+        return;
+    }
+
+    RLMVerifyAttached(obj);
+    // Advancing the read transaction may unmap the memory the value points
+    // into, so suspend auto-refresh until the block returns
+    struct AutoRefreshSuspender {
+        realm::Realm& realm;
+        bool autoRefresh;
+        ~AutoRefreshSuspender() {
+            realm.set_auto_refresh(autoRefresh);
+        }
+    } suspender{*obj->_realm->_realm, obj->_realm->_realm->auto_refresh()};
+    suspender.realm.set_auto_refresh(false);
+
+    realm::ColKey col = obj->_info->tableColumn(prop);
+    if (prop.type == RLMPropertyTypeString) {
+        realm::StringData value = obj->_row.get<realm::StringData>(col);
+        block(value.is_null() ? nullptr : value.data(), value.size());
+    }
+    else {
+        realm::BinaryData value = obj->_row.get<realm::BinaryData>(col);
+        // Non-null empty data may not have a non-null pointer
+        block(value.is_null() ? nullptr : value.data() ?: "", value.size());
     }
-    // if table and index are the same
-    return o1->_row.get_table() == o2->_row.get_table()
-        && o1->_row.get_key() == o2->_row.get_key();
 }
 
 static id resolveObject(RLMObjectBase *obj, RLMRealm *realm) {
@@ -657,6 +767,35 @@ struct ObjectChangeCallbackWrapper {
 }
 @end
 
+@implementation RLMKeyPathFilter {
+    NSArray<NSString *> *_keyPaths;
+}
+
+- (instancetype)initWithKeyPaths:(NSArray<NSString *> *)keyPaths {
+    if ((self = [super init])) {
+        _keyPaths = [keyPaths copy];
+        _cacheKey = RLMKeyPathCacheKey(_keyPaths);
+    }
+    return self;
+}
+
++ (instancetype)filterWithKeyPaths:(NSArray<NSString *> *)keyPaths {
+    return [[self alloc] initWithKeyPaths:keyPaths];
+}
+
+- (NSUInteger)count {
+    return _keyPaths.count;
+}
+
+- (NSString *)objectAtIndex:(NSUInteger)index {
+    return _keyPaths[index];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+@end
+
 enum class TokenState {
     Initializing,
     Cancelled,
@@ -725,8 +864,28 @@ RLM_DIRECT_MEMBERS
     RLMObjectBase *obj = [_realm resolveThreadSafeReference:tsr];
 
     _object = realm::Object(_realm->_realm, *obj->_info->objectSchema, obj->_row);
-    _token = _object.add_notification_callback(ObjectChangeCallbackWrapper{block, obj},
-                                               obj->_info->keyPathArrayFromStringArray(keyPaths));
+    RLMTranslateError([&] {
+        _token = _object.add_notification_callback(ObjectChangeCallbackWrapper{block, obj},
+                                                   obj->_info->keyPathArrayFromStringArray(keyPaths));
+    });
+}
+
+- (void)addNotificationBlock:(RLMObjectNotificationCallback)block
+                       realm:(RLMRealm *)realm
+                      object:(RLMObjectBase *)obj
+                    keyPaths:(NSArray *)keyPaths {
+    std::lock_guard lock(_mutex);
+    if (_state != TokenState::Initializing) {
+        // Token was invalidated before we got this far
+        return;
+    }
+
+    _realm = realm;
+    _object = realm::Object(_realm->_realm, *obj->_info->objectSchema, obj->_row);
+    RLMTranslateError([&] {
+        _token = _object.add_notification_callback(ObjectChangeCallbackWrapper{block, obj},
+                                                   obj->_info->keyPathArrayFromStringArray(keyPaths));
+    });
 }
 
 - (void)observe:(RLMObjectBase *)obj
@@ -761,6 +920,26 @@ RLM_DIRECT_MEMBERS
     }
 }
 
+// Report that no notifier will be registered for this token because the object
+// was deleted or the Realm could not be opened. Nothing is reported if the token
+// was invalidated first.
+- (void)finishWithBlock:(RLMObjectNotificationCallback)block error:(NSError *)error {
+    dispatch_block_t completion;
+    {
+        std::lock_guard lock(_mutex);
+        if (_state != TokenState::Initializing) {
+            return;
+        }
+        _realm = nil;
+        _state = TokenState::Cancelled;
+        std::swap(completion, _completion);
+    }
+    if (completion) {
+        completion();
+    }
+    block(nil, nil, nil, nil, error);
+}
+
 - (void)registrationComplete:(void (^)())completion {
     {
         std::lock_guard lock(_mutex);
@@ -798,11 +977,92 @@ RLMNotificationToken *RLMObjectBaseAddNotificationBlock(RLMObjectBase *obj,
     });
     return token;
 }
+
+NSArray<RLMNotificationToken *> *RLMObjectBaseAddNotificationBlocks(NSArray<RLMObjectBase *> *objects,
+                                                                    NSArray<NSString *> *keyPaths,
+                                                                    dispatch_queue_t queue,
+                                                                    NSArray<RLMObjectNotificationCallback> *blocks) {
+    REALM_ASSERT(objects.count == blocks.count);
+    NSUInteger count = objects.count;
+    if (count == 0) {
+        return @[];
+    }
+
+    RLMRealm *realm = static_cast<RLMObjectBase *>(objects[0])->_realm;
+    if (!realm) {
+        @throw RLMException(@"Only objects which are managed by a Realm support change notifications");
+    }
+    if (realm.inWriteTransaction) {
+        @throw RLMException(@"Cannot register notification blocks from within write transactions.");
+    }
+
+    // Rather than handing each object over with its own thread-safe reference
+    // and opening the Realm on the queue once per object, record the object
+    // keys and the version they were read at and resolve all of them at once
+    // on the target queue.
+    auto keys = std::make_shared<std::vector<realm::ObjKey>>();
+    keys->reserve(count);
+    auto classNames = [NSMutableArray arrayWithCapacity:count];
+    auto tokens = [NSMutableArray arrayWithCapacity:count];
+    for (RLMObjectBase *obj in objects) {
+        if (!obj->_realm) {
+            @throw RLMException(@"Only objects which are managed by a Realm support change notifications");
+        }
+        if (obj->_realm != realm) {
+            @throw RLMException(@"All objects must be managed by the same Realm.");
+        }
+        RLMVerifyAttached(obj);
+        keys->push_back(obj->_row.get_key());
+        [classNames addObject:obj->_info->rlmObjectSchema.className];
+
+        auto token = [[RLMObjectNotificationToken alloc] init];
+        token->_realm = realm;
+        [tokens addObject:token];
+    }
+
+    auto version = realm->_realm->read_transaction_version();
+    RLMRealmConfiguration *config = realm.configurationSharingSchema;
+    NSArray *tokensCopy = [tokens copy];
+    NSArray *blocksCopy = [blocks copy];
+    dispatch_async(queue, ^{
+        @autoreleasepool {
+            NSError *error;
+            RLMRealm *target = [RLMRealm realmWithConfiguration:config queue:queue error:&error];
+            if (!target) {
+                for (NSUInteger i = 0; i < count; ++i) {
+                    [tokensCopy[i] finishWithBlock:blocksCopy[i] error:error];
+                }
+                return;
+            }
+            // The Realm cached for this queue may not have been refreshed to
+            // the version which the objects were read from yet
+            target->_realm->read_group();
+            if (target->_realm->read_transaction_version() < version) {
+                [target refresh];
+            }
+
+            for (NSUInteger i = 0; i < count; ++i) {
+                auto key = (*keys)[i];
+                RLMClassInfo& info = target->_info[classNames[i]];
+                RLMObjectNotificationCallback block = blocksCopy[i];
+                if (!info.table()->is_valid(key)) {
+                    // Deleted before the notifier could be registered
+                    [tokensCopy[i] finishWithBlock:block error:nil];
+                    continue;
+                }
+                RLMObjectBase *obj = RLMCreateObjectAccessor(info, info.table()->get_object(key));
+                [tokensCopy[i] addNotificationBlock:block realm:target object:obj keyPaths:keyPaths];
+            }
+        }
+    });
+    return tokensCopy;
+}
+
 @end
 
-RLMNotificationToken *RLMObjectAddNotificationBlock(RLMObjectBase *obj, RLMObjectChangeBlock block, NSArray<NSString *> *keyPaths, dispatch_queue_t queue) {
-    return RLMObjectBaseAddNotificationBlock(obj, keyPaths, queue, ^(RLMObjectBase *, NSArray<NSString *> *propertyNames,
-                                                           NSArray *oldValues, NSArray *newValues, NSError *error) {
+static RLMObjectNotificationCallback RLMWrapObjectChangeBlock(RLMObjectChangeBlock block) {
+    return ^(RLMObjectBase *, NSArray<NSString *> *propertyNames,
+             NSArray *oldValues, NSArray *newValues, NSError *error) {
         if (error) {
             block(false, nil, error);
         }
@@ -820,7 +1080,22 @@ RLMNotificationToken *RLMObjectAddNotificationBlock(RLMObjectBase *obj, RLMObjec
             }
             block(false, properties, nil);
         }
-    });
+    };
+}
+
+RLMNotificationToken *RLMObjectAddNotificationBlock(RLMObjectBase *obj, RLMObjectChangeBlock block, NSArray<NSString *> *keyPaths, dispatch_queue_t queue) {
+    return RLMObjectBaseAddNotificationBlock(obj, keyPaths, queue, RLMWrapObjectChangeBlock(block));
+}
+
+NSArray<RLMNotificationToken *> *RLMObjectAddNotificationBlocks(NSArray<RLMObjectBase *> *objects, RLMObjectsChangeBlock block,
+                                                                NSArray<NSString *> *keyPaths, dispatch_queue_t queue) {
+    auto blocks = [NSMutableArray arrayWithCapacity:objects.count];
+    for (NSUInteger i = 0, count = objects.count; i < count; ++i) {
+        [blocks addObject:RLMWrapObjectChangeBlock(^(BOOL deleted, NSArray<RLMPropertyChange *> *changes, NSError *error) {
+            block(i, deleted, changes, error);
+        })];
+    }
+    return RLMObjectBaseAddNotificationBlocks(objects, keyPaths, queue, blocks);
 }
 
 uint64_t RLMObjectBaseGetCombineId(__unsafe_unretained RLMObjectBase *const obj) {
@@ -31,6 +31,8 @@
 #import <realm/object-store/object_schema.hpp>
 #import <realm/object-store/object_store.hpp>
 
+#import <mutex>
+
 using namespace realm;
 
 @protocol RLMCustomEventRepresentable
@@ -44,6 +46,7 @@ using namespace realm;
 
 @implementation RLMObjectSchema {
     std::string _objectStoreName;
+    std::once_flag _objectStoreNameOnce;
 }
 
 - (instancetype)initWithClassName:(NSString *)objectClassName objectClass:(Class)objectClass properties:(NSArray *)properties {
@@ -201,6 +204,18 @@ using namespace realm;
         }
     }
 
+    for (NSString *propertyName in [objectClass internedStringProperties]) {
+        RLMProperty *prop = schema[propertyName];
+        if (!prop) {
+            @throw RLMException(@"Interned property '%@' does not exist on object '%@'", propertyName, className);
+        }
+        if (prop.type != RLMPropertyTypeString || prop.collection) {
+            @throw RLMException(@"Property '%@' cannot be interned on '%@' because it is not a 'string' property.",
+                                propertyName, className);
+        }
+        prop.interned = YES;
+    }
+
     for (RLMProperty *prop in schema.properties) {
         if (prop.optional && prop.collection && !prop.dictionary && (prop.type == RLMPropertyTypeObject || prop.type == RLMPropertyTypeLinkingObjects)) {
             // FIXME: message is awkward
@@ -335,9 +350,11 @@ using namespace realm;
 }
 
 - (std::string const&)objectStoreName {
-    if (_objectStoreName.empty()) {
+    // The shared schema is used by concurrent opens of different files, so
+    // the cached name is computed exactly once
+    std::call_once(_objectStoreNameOnce, [&] {
         _objectStoreName = self.objectName.UTF8String;
-    }
+    });
     return _objectStoreName;
 }
 
@@ -43,9 +43,17 @@ void RLMVerifyInWriteTransaction(RLMRealm *const realm);
 // add an object to the given realm
 void RLMAddObjectToRealm(RLMObjectBase *object, RLMRealm *realm, RLMUpdatePolicy);
 
+// add each object in a collection to the given realm, performing per-class
+// validation and setup once per class rather than once per object
+void RLMAddObjectsToRealm(id<NSFastEnumeration> objects, RLMRealm *realm, RLMUpdatePolicy);
+
 // delete an object from its realm
 void RLMDeleteObjectFromRealm(RLMObjectBase *object, RLMRealm *realm);
 
+// delete each object in a collection from the realm, removing the objects
+// from each table in a single batch
+void RLMDeleteObjectsFromRealm(id<NSFastEnumeration> objects, RLMRealm *realm);
+
 // deletes all objects from a realm
 void RLMDeleteAllObjectsFromRealm(RLMRealm *realm);
 
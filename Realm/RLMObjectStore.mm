@@ -118,6 +118,49 @@ void RLMAddObjectToRealm(__unsafe_unretained RLMObjectBase *const object,
     c.createObject(object, createPolicy);
 }
 
+void RLMAddObjectsToRealm(id<NSFastEnumeration> objects, __unsafe_unretained RLMRealm *const realm,
+                          RLMUpdatePolicy updatePolicy) {
+    RLMVerifyInWriteTransaction(realm);
+
+    CreatePolicy createPolicy = updatePolicyToCreatePolicy(updatePolicy);
+    createPolicy.copy = false;
+
+    // One accessor context per class, so that the class info lookup, primary
+    // key validation and default values are done once per class. Inputs
+    // typically contain only a few classes, and often runs of a single class.
+    std::vector<std::pair<__unsafe_unretained RLMObjectSchema *, std::unique_ptr<RLMAccessorContext>>> contexts;
+    __unsafe_unretained RLMObjectSchema *currentSchema = nil;
+    RLMAccessorContext *currentContext = nullptr;
+
+    for (RLMObjectBase *obj in objects) {
+        if (![obj isKindOfClass:RLMObjectBase.class]) {
+            if (updatePolicy == RLMUpdatePolicyError) {
+                @throw RLMException(@"Cannot insert objects of type %@ with addObjects:. Only RLMObjects are supported.",
+                                    NSStringFromClass(obj.class));
+            }
+            @throw RLMException(@"Cannot add or update objects of type %@ with addOrUpdateObjects:. Only RLMObjects are"
+                                " supported.",
+                                NSStringFromClass(obj.class));
+        }
+
+        RLMObjectSchema *objectSchema = obj->_objectSchema;
+        if (objectSchema != currentSchema) {
+            auto it = std::find_if(contexts.begin(), contexts.end(),
+                                   [&](auto& pair) { return pair.first == objectSchema; });
+            if (it == contexts.end()) {
+                if (updatePolicy != RLMUpdatePolicyError && !objectSchema.primaryKeyProperty) {
+                    @throw RLMException(@"'%@' does not have a primary key and can not be updated", objectSchema.className);
+                }
+                auto& info = realm->_info[objectSchema.className];
+                it = contexts.emplace(contexts.end(), objectSchema, std::make_unique<RLMAccessorContext>(info));
+            }
+            currentSchema = objectSchema;
+            currentContext = it->second.get();
+        }
+        currentContext->createObject(obj, createPolicy);
+    }
+}
+
 RLMObjectBase *RLMCreateObjectInRealmWithValue(RLMRealm *realm, NSString *className,
                                                id value, RLMUpdatePolicy updatePolicy) {
     RLMVerifyInWriteTransaction(realm);
@@ -181,6 +224,77 @@ void RLMDeleteObjectFromRealm(__unsafe_unretained RLMObjectBase *const object,
     object->_realm = nil;
 }
 
+void RLMDeleteObjectsFromRealm(id<NSFastEnumeration> objects, __unsafe_unretained RLMRealm *const realm) {
+    // Group the objects by table so that each table's objects can be removed
+    // in a single batch. Inputs typically contain only a few types, and often
+    // runs of a single type.
+    std::vector<std::pair<TableRef, std::vector<ObjKey>>> tables;
+    std::pair<TableRef, std::vector<ObjKey>> *current = nullptr;
+    std::vector<RLMObjectBase *> deleted;
+
+    for (RLMObjectBase *obj in objects) {
+        if (![obj isKindOfClass:RLMObjectBase.class]) {
+            @throw RLMException(@"Cannot delete objects of type %@ with deleteObjects:. Only RLMObjects can be deleted.",
+                                NSStringFromClass(obj.class));
+        }
+        if (realm != obj->_realm) {
+            @throw RLMException(@"Can only delete an object from the Realm it belongs to.");
+        }
+        if (deleted.empty()) {
+            RLMVerifyInWriteTransaction(realm);
+        }
+        deleted.push_back(obj);
+        if (!obj->_row.is_valid()) {
+            continue;
+        }
+
+        auto tableKey = obj->_row.get_table()->get_key();
+        if (!current || current->first->get_key() != tableKey) {
+            auto it = std::find_if(tables.begin(), tables.end(),
+                                   [&](auto& pair) { return pair.first->get_key() == tableKey; });
+            if (it == tables.end()) {
+                it = tables.emplace(tables.end(), obj->_row.get_table(), std::vector<ObjKey>());
+            }
+            current = &*it;
+        }
+        current->second.push_back(obj->_row.get_key());
+    }
+
+    // A single tracker handles the KVO notifications for every deleted object
+    // and anything removed by cascading deletes
+    if (!tables.empty()) {
+        RLMObservationTracker tracker(realm, true);
+        for (auto& [table, keys] : tables) {
+            // The same object may have been passed more than once
+            std::sort(keys.begin(), keys.end());
+            keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+            // Deleting an earlier table may have already removed some of
+            // these objects via cascading deletes (e.g. an embedded object
+            // whose parent was also passed in), so re-check validity here
+            // rather than relying on the check made while gathering keys
+            keys.erase(std::remove_if(keys.begin(), keys.end(),
+                                      [&](ObjKey key) { return !table->is_valid(key); }),
+                       keys.end());
+            if (table->is_embedded()) {
+                // Embedded objects have to be removed individually so that
+                // the link from the parent object is cleared. Removing one
+                // embedded object can cascade to others in the same table.
+                for (auto key : keys) {
+                    if (table->is_valid(key)) {
+                        table->get_object(key).remove();
+                    }
+                }
+            }
+            else if (!keys.empty()) {
+                table->batch_erase_objects(keys);
+            }
+        }
+    }
+    for (RLMObjectBase *obj in deleted) {
+        obj->_realm = nil;
+    }
+}
+
 void RLMDeleteAllObjectsFromRealm(RLMRealm *realm) {
     RLMVerifyInWriteTransaction(realm);
 
@@ -204,7 +318,7 @@ RLMResults *RLMGetObjects(__unsafe_unretained RLMRealm *const realm,
     }
 
     if (predicate) {
-        realm::Query query = RLMPredicateToQuery(predicate, info.rlmObjectSchema, realm.schema, realm.group);
+        realm::Query query = RLMPredicateToQuery(predicate, info);
         return [RLMResults resultsWithObjectInfo:info
                                          results:realm::Results(realm->_realm, std::move(query))];
     }
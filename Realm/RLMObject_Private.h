@@ -65,11 +65,24 @@ FOUNDATION_EXTERN RLMNotificationToken *RLMObjectBaseAddNotificationBlock(RLMObj
                                                                           dispatch_queue_t _Nullable queue,
                                                                           RLMObjectNotificationCallback block);
 
+// Register notification blocks for several objects managed by the same Realm,
+// resolving all of them on `queue` in a single dispatch. `blocks` must contain
+// one block for each object.
+FOUNDATION_EXTERN NSArray<RLMNotificationToken *> *RLMObjectBaseAddNotificationBlocks(NSArray<RLMObjectBase *> *objects,
+                                                                                      NSArray<NSString *> *_Nullable keyPaths,
+                                                                                      dispatch_queue_t queue,
+                                                                                      NSArray<RLMObjectNotificationCallback> *blocks);
+
 RLMNotificationToken *RLMObjectAddNotificationBlock(RLMObjectBase *obj,
                                                     RLMObjectChangeBlock block,
                                                     NSArray<NSString *> *_Nullable keyPaths,
                                                     dispatch_queue_t _Nullable queue);
 
+NSArray<RLMNotificationToken *> *RLMObjectAddNotificationBlocks(NSArray<RLMObjectBase *> *objects,
+                                                                RLMObjectsChangeBlock block,
+                                                                NSArray<NSString *> *_Nullable keyPaths,
+                                                                dispatch_queue_t queue);
+
 // Returns whether the class is a descendent of RLMObjectBase
 FOUNDATION_EXTERN BOOL RLMIsObjectOrSubclass(Class klass);
 
@@ -86,6 +99,23 @@ FOUNDATION_EXTERN id RLMObjectThaw(RLMObjectBase *obj);
 // change when an unmanaged object is added to the Realm.
 FOUNDATION_EXTERN uint64_t RLMObjectBaseGetCombineId(RLMObjectBase *);
 
+// The table and object key of a managed object, which together identify the
+// object within its Realm.
+typedef struct RLMObjectIdentity {
+    uint32_t tableKey;
+    int64_t objectKey;
+} RLMObjectIdentity;
+
+// Reads the identity of a managed object without reading any of its properties.
+// Returns false for unmanaged objects.
+FOUNDATION_EXTERN bool RLMObjectBaseGetIdentity(RLMObjectBase *obj, RLMObjectIdentity *identity);
+
+// Calls `block` with the stored bytes of a string or data property. For managed
+// objects this points into the Realm file, and auto-refresh is suspended while
+// the block runs so that the Realm's version can't advance.
+FOUNDATION_EXTERN void RLMObjectBaseWithUnsafeBytes(RLMObjectBase *obj, NSString *propertyName,
+                                                    void (NS_NOESCAPE ^block)(const void *_Nullable bytes, NSUInteger length));
+
 // An accessor object which is used to interact with Swift properties from obj-c
 @interface RLMManagedPropertyAccessor : NSObject
 // Perform any initialization required for KVO on a *unmanaged* object
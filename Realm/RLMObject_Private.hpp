@@ -35,6 +35,13 @@ class RLMObservationInfo;
 }
 @end
 
+@interface RLMKeyPathFilter () {
+    @public
+    // The key under which RLMClassInfo caches the resolved key paths
+    std::string _cacheKey;
+}
+@end
+
 id RLMCreateManagedAccessor(Class cls, RLMClassInfo *info) NS_RETURNS_RETAINED;
 
 // throw an exception if the object is invalidated or on the wrong thread
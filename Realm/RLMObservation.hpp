@@ -23,8 +23,11 @@
 #import <realm/object-store/impl/deep_change_checker.hpp>
 #import <realm/table.hpp>
 
+#import <unordered_map>
+
 @class RLMObjectBase, RLMRealm, RLMSchema, RLMProperty, RLMObjectSchema;
 class RLMClassInfo;
+class RLMObservedObjects;
 class RLMSchemaInfo;
 
 namespace realm {
@@ -39,8 +42,8 @@ namespace realm {
 // RLMObservationInfo instances, so it could be folded into RLMObjectBase, and
 // is a separate class mostly to avoid making all accessor objects far larger.
 //
-// RLMClassInfo stores a vector of pointers to the first observation info
-// created for each row. If there are multiple observation infos for a single
+// RLMClassInfo stores a hash-indexed set of pointers to the first observation
+// info created for each row. If there are multiple observation infos for a single
 // row (such as if there are multiple observed objects backed by a single row,
 // or if both an object and an array property of that object are observed),
 // they're stored in an intrusive doubly-linked-list in the `next` and `prev`
@@ -68,9 +71,24 @@ public:
         return row.get_key() == key;
     }
 
+    // Whether the row was deleted while this info was observing it
+    bool isInvalidated() const noexcept {
+        return invalidated;
+    }
+
     void recordObserver(realm::Obj& row, RLMClassInfo *objectInfo, RLMObjectSchema *objectSchema, NSString *keyPath);
     void removeObserver();
     bool hasObservers() const { return observerCount > 0; }
+    // Check if this or any of the later infos for the same row have observers.
+    // Called on the head of the list, this checks all observers of the row.
+    bool rowHasObservers() const {
+        for (auto info = this; info; info = info->next) {
+            if (info->observerCount) {
+                return true;
+            }
+        }
+        return false;
+    }
 
     // valueForKey: on observed object and array properties needs to return the
     // same object each time for KVO to work at all. Doing this all the time
@@ -138,8 +156,8 @@ private:
 };
 
 // Get the the observation info chain for the given row
-// Will simply return info if it's non-null, and will search ojectSchema's array
-// for a matching one otherwise, and return null if there are none
+// Will simply return info if it's non-null, and will look up the row in
+// objectSchema's observed objects otherwise, and return null if there are none
 RLMObservationInfo *RLMGetObservationInfo(RLMObservationInfo *info, realm::ObjKey row, RLMClassInfo& objectSchema);
 
 // delete all objects from a single table with change notifications
@@ -158,7 +176,8 @@ public:
     void didChange();
 
 private:
-    std::vector<std::vector<RLMObservationInfo *> *> _observedTables;
+    // The observed objects for each table with any, sorted by table key
+    std::vector<std::pair<realm::TableKey, RLMObservedObjects *>> _observedTables;
     __unsafe_unretained RLMRealm const*_realm;
     realm::Group& _group;
     RLMObservationInfo *_info = nullptr;
@@ -175,6 +194,28 @@ private:
     std::vector<Change> _changes;
     std::vector<RLMObservationInfo *> _invalidated;
 
+    // The position in `_changes` of the change for each list property which
+    // has had objects removed, keyed on the observed row and column
+    struct ListChangeKey {
+        RLMObservationInfo *info;
+        int64_t col;
+        bool operator==(ListChangeKey const& other) const noexcept {
+            return info == other.info && col == other.col;
+        }
+    };
+    struct ListChangeKeyHash {
+        size_t operator()(ListChangeKey const& key) const noexcept {
+            return std::hash<void *>()(key.info) ^ std::hash<int64_t>()(key.col);
+        }
+    };
+    std::unordered_map<ListChangeKey, size_t, ListChangeKeyHash> _listChanges;
+
+    // The (position in `_changes`, list index) pairs for list indexes removed
+    // by the current cascade notification. These are gathered here and only
+    // converted to NSIndexSets once all of the removals are known, and the
+    // storage is reused between cascade notifications.
+    std::vector<std::pair<size_t, size_t>> _removedIndexes;
+
     template<typename CascadeNotification>
     void cascadeNotification(CascadeNotification const&);
 };
@@ -78,20 +78,14 @@ RLMObservationInfo::~RLMObservationInfo() {
         }
     }
     else if (objectSchema) {
-        // The head of the list, so remove self from the object schema's array
+        // The head of the list, so remove self from the object schema's set
         // of observation info, either replacing self with the next info or
-        // removing entirely if there is no next
-        auto end = objectSchema->observedObjects.end();
-        auto it = find(objectSchema->observedObjects.begin(), end, this);
-        if (it != end) {
-            if (next) {
-                *it = next;
-                next->prev = nullptr;
-            }
-            else {
-                iter_swap(it, std::prev(end));
-                objectSchema->observedObjects.pop_back();
-            }
+        // removing entirely if there is no next. The list may no longer be in
+        // the set if its row was deleted and the key reused, but the next
+        // info still becomes the head.
+        objectSchema->observedObjects.replace(this, next);
+        if (next) {
+            next->prev = nullptr;
         }
     }
     // Otherwise the observed object was unmanaged, so nothing to do
@@ -145,17 +139,15 @@ void RLMObservationInfo::setRow(realm::Table const& table, realm::ObjKey key) {
     REALM_ASSERT_DEBUG(!row);
     REALM_ASSERT_DEBUG(objectSchema);
     row = table.get_object(key);
-    for (auto info : objectSchema->observedObjects) {
-        if (info->row && info->row.get_key() == key) {
-            prev = info;
-            next = info->next;
-            if (next)
-                next->prev = this;
-            info->next = this;
-            return;
-        }
+    if (auto info = objectSchema->observedObjects.find(key)) {
+        prev = info;
+        next = info->next;
+        if (next)
+            next->prev = this;
+        info->next = this;
+        return;
     }
-    objectSchema->observedObjects.push_back(this);
+    objectSchema->observedObjects.insert(this);
 }
 
 void RLMObservationInfo::recordObserver(realm::Obj& objectRow, RLMClassInfo *objectInfo,
@@ -262,14 +254,53 @@ RLMObservationInfo *RLMGetObservationInfo(RLMObservationInfo *info, realm::ObjKe
     if (info) {
         return info;
     }
+    return objectSchema.observedObjects.find(row);
+}
 
-    for (RLMObservationInfo *info : objectSchema.observedObjects) {
-        if (info->isForRow(row)) {
-            return info;
-        }
+RLMObservationInfo *RLMObservedObjects::find(realm::ObjKey key) const noexcept {
+    auto it = m_index.find(key.value);
+    if (it == m_index.end() || m_infos[it->second]->isInvalidated()) {
+        return nullptr;
     }
+    return m_infos[it->second];
+}
+
+void RLMObservedObjects::insert(RLMObservationInfo *info) {
+    auto [it, inserted] = m_index.emplace(info->getRow().get_key().value, m_infos.size());
+    if (!inserted) {
+        // The key was reused by a new object after the previously observed
+        // object was deleted, so the new object gets a list of its own
+        REALM_ASSERT_DEBUG(m_infos[it->second]->isInvalidated());
+        m_infos[it->second] = info;
+        return;
+    }
+    m_infos.push_back(info);
+}
+
+bool RLMObservedObjects::replace(RLMObservationInfo *info, RLMObservationInfo *replacement) {
+    auto it = m_index.find(info->getRow().get_key().value);
+    if (it == m_index.end() || m_infos[it->second] != info) {
+        return false;
+    }
+    if (replacement) {
+        m_infos[it->second] = replacement;
+        return true;
+    }
+
+    // Swap the last entry into the removed slot and update its index
+    size_t pos = it->second;
+    m_index.erase(it);
+    if (pos + 1 != m_infos.size()) {
+        m_infos[pos] = m_infos.back();
+        m_index[m_infos[pos]->getRow().get_key().value] = pos;
+    }
+    m_infos.pop_back();
+    return true;
+}
 
-    return nullptr;
+void RLMObservedObjects::clear() noexcept {
+    m_infos.clear();
+    m_index.clear();
 }
 
 void RLMClearTable(RLMClassInfo &objectSchema) {
@@ -331,8 +362,9 @@ void RLMObservationTracker::trackDeletions() {
     }
 
     for (auto& info : _realm->_info) {
-        if (!info.second.observedObjects.empty()) {
-            _observedTables.push_back(&info.second.observedObjects);
+        auto& observed = info.second.observedObjects;
+        if (!observed.empty()) {
+            _observedTables.push_back({observed.front()->getRow().get_table()->get_key(), &observed});
         }
     }
 
@@ -340,6 +372,8 @@ void RLMObservationTracker::trackDeletions() {
     if (_observedTables.empty()) {
         return;
     }
+    std::sort(begin(_observedTables), end(_observedTables),
+              [](auto& a, auto& b) { return a.first < b.first; });
 
     _group.set_cascade_notification_handler([this](realm::Group::CascadeNotification const& cs) {
         cascadeNotification(cs);
@@ -355,36 +389,32 @@ void RLMObservationTracker::cascadeNotification(CascadeNotification const& cs) {
     size_t invalidatedCount = _invalidated.size();
     size_t changeCount = _changes.size();
 
-    auto tableKey = [](RLMObservationInfo *info) {
-        return info->getRow().get_table()->get_key();
-    };
-    std::sort(begin(_observedTables), end(_observedTables),
-              [=](auto a, auto b) { return tableKey(a->front()) < tableKey(b->front()); });
     for (auto const& link : cs.links) {
-        auto table = std::find_if(_observedTables.begin(), _observedTables.end(), [&](auto table) {
-            return tableKey(table->front()) == link.origin_table;
-        });
-        if (table == _observedTables.end()) {
+        auto table = std::lower_bound(_observedTables.begin(), _observedTables.end(), link.origin_table,
+                                      [](auto& table, auto key) { return table.first < key; });
+        if (table == _observedTables.end() || table->first != link.origin_table || table->second->empty()) {
             continue;
         }
 
-        for (auto observer : **table) {
-            if (!observer->isForRow(link.origin_key)) {
-                continue;
-            }
-
+        if (auto observer = table->second->find(link.origin_key)) {
             NSString *name = observer->columnName(link.origin_col_key);
             if (!link.origin_col_key.is_list()) {
                 _changes.push_back({observer, name});
                 continue;
             }
 
-            auto c = find_if(begin(_changes), end(_changes), [&](auto const& c) {
-                return c.info == observer && c.property == name;
-            });
-            if (c == end(_changes)) {
-                _changes.push_back({observer, name, [NSMutableIndexSet new]});
-                c = prev(end(_changes));
+            // Computing the removed indexes requires scanning the list, so
+            // only do it if something is observing the row and will be sent
+            // the indexes. The change is still reported without indexes so
+            // that the will/did change calls are balanced.
+            bool hasObservers = observer->rowHasObservers();
+            auto [it, inserted] = _listChanges.try_emplace({observer, link.origin_col_key.value}, _changes.size());
+            if (inserted) {
+                _changes.push_back({observer, name, hasObservers ? [NSMutableIndexSet new] : nil});
+            }
+            size_t changeIndex = it->second;
+            if (!_changes[changeIndex].indexes) {
+                continue;
             }
 
             // We know what row index is being removed from the LinkView,
@@ -392,15 +422,30 @@ void RLMObservationTracker::cascadeNotification(CascadeNotification const& cs) {
             // are going away
             auto linkview = observer->getRow().get_linklist(link.origin_col_key);
             linkview.find_all(link.old_target_key, [&](size_t index) {
-                [c->indexes addIndex:index];
+                _removedIndexes.push_back({changeIndex, index});
             });
         }
     }
+
+    // Add the removed indexes to each change's index set, coalescing runs of
+    // consecutive indexes into a single range
+    if (!_removedIndexes.empty()) {
+        std::sort(_removedIndexes.begin(), _removedIndexes.end());
+        for (auto it = _removedIndexes.begin(), end = _removedIndexes.end(); it != end; ) {
+            auto [changeIndex, first] = *it;
+            size_t last = first;
+            for (++it; it != end && it->first == changeIndex && it->second <= last + 1; ++it) {
+                last = it->second;
+            }
+            [_changes[changeIndex].indexes addIndexesInRange:{first, last - first + 1}];
+        }
+        _removedIndexes.clear();
+    }
+
     if (!cs.rows.empty()) {
         using Row = realm::Group::CascadeNotification::row;
         auto begin = cs.rows.begin();
-        for (auto table : _observedTables) {
-            auto currentTableKey = tableKey(table->front());
+        for (auto [currentTableKey, table] : _observedTables) {
             if (begin->table_key < currentTableKey) {
                 // Find the first deleted object in or after this table
                 begin = std::lower_bound(begin, cs.rows.end(), Row{currentTableKey, realm::ObjKey(0)});
@@ -417,10 +462,20 @@ void RLMObservationTracker::cascadeNotification(CascadeNotification const& cs) {
             // Find the end of the deletions in this table
             auto end = std::lower_bound(begin, cs.rows.end(), Row{realm::TableKey(currentTableKey.value + 1), realm::ObjKey(0)});
 
-            // Check each observed object to see if it's in the deleted rows
-            for (auto info : *table) {
-                if (std::binary_search(begin, end, Row{currentTableKey, info->getRow().get_key()})) {
-                    _invalidated.push_back(info);
+            // Check each observed object to see if it's in the deleted rows,
+            // iterating over whichever of the two is smaller
+            if (size_t(end - begin) < table->size()) {
+                for (auto it = begin; it != end; ++it) {
+                    if (auto info = table->find(it->key)) {
+                        _invalidated.push_back(info);
+                    }
+                }
+            }
+            else {
+                for (auto info : *table) {
+                    if (std::binary_search(begin, end, Row{currentTableKey, info->getRow().get_key()})) {
+                        _invalidated.push_back(info);
+                    }
                 }
             }
 
@@ -463,6 +518,7 @@ void RLMObservationTracker::didChange() {
     }
     _observedTables.clear();
     _changes.clear();
+    _listChanges.clear();
     _invalidated.clear();
 }
 
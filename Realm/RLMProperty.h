@@ -79,6 +79,14 @@ RLM_SWIFT_SENDABLE RLM_FINAL // not actually immutable, but the public API kinda
  */
 @property (nonatomic, readonly) BOOL indexed;
 
+/**
+ Indicates whether string values read from this property are interned, so that
+ reading the same value repeatedly returns the same `NSString` instance.
+
+ @see `+[RLMObject internedStringProperties]`
+ */
+@property (nonatomic, readonly) BOOL interned;
+
 /**
  For `RLMObject` and `RLMCollection` properties, the name of the class of object stored in the property.
  */
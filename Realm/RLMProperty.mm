@@ -645,6 +645,7 @@ static std::optional<RLMPropertyType> typeFromProtocolString(const char *type) {
     prop->_dictionary = _dictionary;
     prop->_dictionaryKeyType = _dictionaryKeyType;
     prop->_indexed = _indexed;
+    prop->_interned = _interned;
     prop->_getterName = _getterName;
     prop->_setterName = _setterName;
     prop->_getterSel = _getterSel;
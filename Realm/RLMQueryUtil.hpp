@@ -18,11 +18,16 @@
 
 #import <Foundation/Foundation.h>
 
+#import <realm/query.hpp>
+
+#import <list>
+#import <memory>
+#import <string>
+#import <unordered_map>
 #import <vector>
 
 namespace realm {
     class Group;
-    class Query;
     class SortDescriptor;
 }
 
@@ -32,5 +37,41 @@ class RLMClassInfo;
 realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMObjectSchema *objectSchema,
                                  RLMSchema *schema, realm::Group &group);
 
+// Convert the predicate to a Query on the table for the given class, reusing
+// the key paths resolved for a previous predicate of the same shape if possible
+realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMClassInfo& info);
+
+// A least-recently-used cache of the parts of compiling a predicate on a single
+// class which do not depend on its constant values. Predicates are keyed on
+// their shape: the operators, options, and key paths of each comparison, with
+// constant values left out. A predicate with the same shape as an earlier one
+// reuses the resolved and validated key paths, and only its comparisons and
+// constants are applied to a new Query, so predicates built with different
+// arguments share a single entry.
+class RLMQueryCache {
+public:
+    struct Plan;
+
+    // Build the Query for the predicate, using and updating the cached plan for
+    // predicates of its shape if it has one which can be cached
+    realm::Query get(NSPredicate *predicate, RLMObjectSchema *objectSchema,
+                     RLMSchema *schema, realm::Group& group);
+    void clear();
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<Plan>>;
+
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+};
+
+// The maximum number of queries cached per class for each RLMRealm instance
+size_t RLMGetQueryCacheCapacity();
+void RLMSetQueryCacheCapacity(size_t capacity);
+// Process-wide statistics for RLMQueryCache
+size_t RLMGetQueryCacheHitCount();
+size_t RLMGetQueryCacheMissCount();
+void RLMResetQueryCacheStatistics();
+
 // return property - throw for invalid column name
 RLMProperty *RLMValidatedProperty(RLMObjectSchema *objectSchema, NSString *columnName);
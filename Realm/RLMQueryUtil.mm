@@ -19,11 +19,14 @@
 #import "RLMQueryUtil.hpp"
 
 #import "RLMAccessor.hpp"
+#import "RLMClassInfo.hpp"
+#import "RLMCollection_Private.h"
 #import "RLMGeospatial_Private.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObject_Private.hpp"
 #import "RLMPredicateUtil.hpp"
 #import "RLMProperty_Private.h"
+#import "RLMRealm_Private.hpp"
 #import "RLMSchema.h"
 #import "RLMUtil.hpp"
 
@@ -36,6 +39,8 @@
 #import <realm/util/cf_ptr.hpp>
 #import <realm/util/overload.hpp>
 
+#import <atomic>
+
 using namespace realm;
 
 namespace {
@@ -474,16 +479,65 @@ private:
 
 struct KeyPath;
 
+// The operator and options of a comparison between a key path and either a
+// constant or another key path, independent of whether it came from an
+// NSComparisonPredicate or an RLMQueryExpression
+struct Comparison {
+    NSPredicateOperatorType type;
+    NSComparisonPredicateOptions options;
+    NSComparisonPredicateModifier modifier;
+    // false if the key path is the right operand of a comparison with a constant
+    bool keyPathOnLeft;
+
+    Comparison(NSPredicateOperatorType type, NSComparisonPredicateOptions options,
+               NSComparisonPredicateModifier modifier, bool keyPathOnLeft)
+    : type(type), options(options), modifier(modifier), keyPathOnLeft(keyPathOnLeft) { }
+
+    Comparison(NSComparisonPredicate *pred)
+    : type(pred.predicateOperatorType)
+    , options(pred.options)
+    , modifier(pred.comparisonPredicateModifier)
+    , keyPathOnLeft(pred.leftExpression.expressionType == NSKeyPathExpressionType) { }
+};
+
+// Sequential reader for the instructions of an RLMQueryExpression
+class QueryExpressionReader {
+public:
+    QueryExpressionReader(RLMQueryExpression *expression)
+    : m_expression(expression)
+    , m_next(static_cast<const uint32_t *>(expression.instructions.bytes))
+    , m_end(m_next + expression.instructions.length / sizeof(uint32_t)) { }
+
+    uint32_t next() {
+        RLMPrecondition(m_next < m_end, @"Invalid predicate", @"Unexpected end of query expression");
+        return *m_next++;
+    }
+    NSString *key_path(uint32_t index) {
+        RLMPrecondition(index < m_expression.keyPaths.count, @"Invalid predicate", @"Invalid key path index %u", index);
+        return m_expression.keyPaths[index];
+    }
+    id value(uint32_t index) {
+        RLMPrecondition(index < m_expression.values.count, @"Invalid predicate", @"Invalid value index %u", index);
+        return m_expression.values[index];
+    }
+
+private:
+    __unsafe_unretained RLMQueryExpression *const m_expression;
+    const uint32_t *m_next;
+    const uint32_t *m_end;
+};
+
 class QueryBuilder {
 public:
-    QueryBuilder(Query& query, Group& group, RLMSchema *schema)
-    : m_query(query), m_group(group), m_schema(schema) { }
+    QueryBuilder(Query& query, Group& group, RLMSchema *schema, RLMQueryCache::Plan *plan = nullptr)
+    : m_query(query), m_group(group), m_schema(schema), m_plan(plan) { }
 
     void apply_predicate(NSPredicate *predicate, RLMObjectSchema *objectSchema);
+    void apply_expression(QueryExpressionReader& reader, RLMObjectSchema *objectSchema);
 
-    void apply_collection_operator_expression(KeyPath&& kp, id value, NSComparisonPredicate *pred);
-    void apply_value_expression(KeyPath&& kp, id value, NSComparisonPredicate *pred);
-    void apply_column_expression(KeyPath&& left, KeyPath&& right, NSComparisonPredicate *predicate);
+    void apply_collection_operator_expression(KeyPath&& kp, id value, Comparison const& comparison);
+    void apply_value_expression(KeyPath&& kp, id value, Comparison const& comparison);
+    void apply_column_expression(KeyPath&& left, KeyPath&& right, Comparison const& comparison);
     void apply_function_expression(RLMObjectSchema *objectSchema, NSExpression *functionExpression,
                                    NSPredicateOperatorType operatorType, NSExpression *right);
     void apply_map_expression(RLMObjectSchema *objectSchema, NSExpression *functionExpression,
@@ -564,12 +618,15 @@ public:
 
     CollectionOperation collection_operation_from_key_path(KeyPath&& kp);
     ColumnReference column_reference_from_key_path(KeyPath&& kp, bool isAggregate);
+    KeyPath key_path(RLMObjectSchema *objectSchema, NSString *keyPath);
     NSString* get_path_elements(std::vector<PathElement> &paths, NSExpression *expression);
 
 private:
     Query& m_query;
     Group& m_group;
     RLMSchema *m_schema;
+    RLMQueryCache::Plan *m_plan;
+    size_t m_nextKeyPath = 0;
 };
 
 #pragma mark Numeric Constraints
@@ -1345,6 +1402,44 @@ KeyPath key_path_from_string(RLMSchema *schema, RLMObjectSchema *objectSchema, N
     links.pop_back();
     return {std::move(links), property, collectionOperation, keyPathContainsToManyRelationship};
 }
+} // anonymous namespace
+
+// The key paths resolved while compiling a predicate, in the order in which
+// they were resolved. Compiling another predicate of the same shape resolves
+// the same key paths in the same order.
+struct RLMQueryCache::Plan {
+    struct ResolvedKeyPath {
+        RLMObjectSchema *objectSchema;
+        NSString *keyPath;
+        KeyPath resolved;
+    };
+    std::vector<ResolvedKeyPath> keyPaths;
+    // false while the first predicate of this shape is being compiled
+    bool complete = false;
+};
+
+namespace {
+KeyPath QueryBuilder::key_path(RLMObjectSchema *objectSchema, NSString *keyPath)
+{
+    if (!m_plan) {
+        return key_path_from_string(m_schema, objectSchema, keyPath);
+    }
+    if (!m_plan->complete) {
+        auto kp = key_path_from_string(m_schema, objectSchema, keyPath);
+        m_plan->keyPaths.push_back({objectSchema, [keyPath copy], kp});
+        return kp;
+    }
+
+    // Check that this is the key path which was resolved at this point last
+    // time rather than relying on the shape to guarantee it
+    if (m_nextKeyPath < m_plan->keyPaths.size()) {
+        auto& entry = m_plan->keyPaths[m_nextKeyPath++];
+        if (entry.objectSchema == objectSchema && [entry.keyPath isEqualToString:keyPath]) {
+            return entry.resolved;
+        }
+    }
+    return key_path_from_string(m_schema, objectSchema, keyPath);
+}
 
 ColumnReference QueryBuilder::column_reference_from_key_path(KeyPath&& kp, bool isAggregate)
 {
@@ -1587,35 +1682,35 @@ NSPredicateOperatorType invert_comparison_operator(NSPredicateOperatorType type)
 }
 
 void QueryBuilder::apply_collection_operator_expression(KeyPath&& kp, id value,
-                                                        NSComparisonPredicate *pred) {
+                                                        Comparison const& comparison) {
     CollectionOperation operation = collection_operation_from_key_path(std::move(kp));
     operation.validate_comparison(value);
 
-    auto type = pred.predicateOperatorType;
-    if (pred.leftExpression.expressionType != NSKeyPathExpressionType) {
+    auto type = comparison.type;
+    if (!comparison.keyPathOnLeft) {
         // Turn "a > b" into "b < a" so that we can always put the column on the lhs
         type = invert_comparison_operator(type);
     }
-    add_collection_operation_constraint(type, operation, value, pred.options);
+    add_collection_operation_constraint(type, operation, value, comparison.options);
 }
 
-void QueryBuilder::apply_value_expression(KeyPath&& kp, id value, NSComparisonPredicate *pred)
+void QueryBuilder::apply_value_expression(KeyPath&& kp, id value, Comparison const& comparison)
 {
     if (key_path_contains_collection_operator(kp)) {
-        apply_collection_operator_expression(std::move(kp), value, pred);
+        apply_collection_operator_expression(std::move(kp), value, comparison);
         return;
     }
 
-    bool isAny = pred.comparisonPredicateModifier == NSAnyPredicateModifier;
+    bool isAny = comparison.modifier == NSAnyPredicateModifier;
     ColumnReference column = column_reference_from_key_path(std::move(kp), isAny);
 
     // check to see if this is a between query
-    if (pred.predicateOperatorType == NSBetweenPredicateOperatorType) {
+    if (comparison.type == NSBetweenPredicateOperatorType) {
         add_between_constraint(std::move(column), value);
         return;
     }
 
-    if (pred.predicateOperatorType == NSInPredicateOperatorType) {
+    if (comparison.type == NSInPredicateOperatorType) {
         if ([value conformsToProtocol:@protocol(RLMGeospatial)]) {
             // In case of `IN` check if the value is a Geo-shape, create a `geoWithin` query
             add_within_constraint(std::move(column), value);
@@ -1624,21 +1719,21 @@ void QueryBuilder::apply_value_expression(KeyPath&& kp, id value, NSComparisonPr
             process_or_group(m_query, value, [&](id item) {
                 id normalized = value_from_constant_expression_or_value(item);
                 column.validate_comparison(normalized);
-                add_constraint(NSEqualToPredicateOperatorType, pred.options, column, normalized);
+                add_constraint(NSEqualToPredicateOperatorType, comparison.options, column, normalized);
             });
         }
         return;
     }
 
     column.validate_comparison(value);
-    if (pred.leftExpression.expressionType == NSKeyPathExpressionType) {
-        add_constraint(pred.predicateOperatorType, pred.options, std::move(column), value);
+    if (comparison.keyPathOnLeft) {
+        add_constraint(comparison.type, comparison.options, std::move(column), value);
     } else {
-        add_constraint(invert_comparison_operator(pred.predicateOperatorType), pred.options, std::move(column), value);
+        add_constraint(invert_comparison_operator(comparison.type), comparison.options, std::move(column), value);
     }
 }
 
-void QueryBuilder::apply_column_expression(KeyPath&& leftKeyPath, KeyPath&& rightKeyPath, NSComparisonPredicate *predicate)
+void QueryBuilder::apply_column_expression(KeyPath&& leftKeyPath, KeyPath&& rightKeyPath, Comparison const& comparison)
 {
     bool left_key_path_contains_collection_operator = key_path_contains_collection_operator(leftKeyPath);
     bool right_key_path_contains_collection_operator = key_path_contains_collection_operator(rightKeyPath);
@@ -1650,15 +1745,15 @@ void QueryBuilder::apply_column_expression(KeyPath&& leftKeyPath, KeyPath&& righ
         CollectionOperation left = collection_operation_from_key_path(std::move(leftKeyPath));
         ColumnReference right = column_reference_from_key_path(std::move(rightKeyPath), false);
         left.validate_comparison(right);
-        add_collection_operation_constraint(predicate.predicateOperatorType, std::move(left), std::move(right), predicate.options);
+        add_collection_operation_constraint(comparison.type, std::move(left), std::move(right), comparison.options);
         return;
     }
     if (right_key_path_contains_collection_operator) {
         ColumnReference left = column_reference_from_key_path(std::move(leftKeyPath), false);
         CollectionOperation right = collection_operation_from_key_path(std::move(rightKeyPath));
         right.validate_comparison(left);
-        add_collection_operation_constraint(invert_comparison_operator(predicate.predicateOperatorType),
-                                            std::move(right), std::move(left), predicate.options);
+        add_collection_operation_constraint(invert_comparison_operator(comparison.type),
+                                            std::move(right), std::move(left), comparison.options);
         return;
     }
 
@@ -1674,7 +1769,7 @@ void QueryBuilder::apply_column_expression(KeyPath&& leftKeyPath, KeyPath&& righ
                     RLMTypeToString(right.type()));
 
     // TODO: Should we handle special case where left row is the same as right row (tautology)
-    add_constraint(predicate.predicateOperatorType, predicate.options,
+    add_constraint(comparison.type, comparison.options,
                    std::move(left), std::move(right));
 }
 
@@ -1707,7 +1802,7 @@ void QueryBuilder::apply_map_expression(RLMObjectSchema *objectSchema, NSExpress
     std::vector<PathElement> pathElements;
     NSString *keyPath = get_path_elements(pathElements, functionExpression);
 
-    ColumnReference collectionColumn = column_reference_from_key_path(key_path_from_string(m_schema, objectSchema, keyPath), true);
+    ColumnReference collectionColumn = column_reference_from_key_path(key_path(objectSchema, keyPath), true);
 
     if (collectionColumn.property().type == RLMPropertyTypeAny && !collectionColumn.property().dictionary) {
         add_mixed_constraint(operatorType, options, std::move(collectionColumn.resolve<realm::Mixed>().path(pathElements)), right.constantValue);
@@ -1738,7 +1833,7 @@ void QueryBuilder::apply_function_expression(RLMObjectSchema *objectSchema, NSEx
     NSExpression *subqueryExpression = functionExpression.operand;
     int64_t value = [right.constantValue integerValue];
 
-    ColumnReference collectionColumn = column_reference_from_key_path(key_path_from_string(m_schema, objectSchema, [subqueryExpression.collection keyPath]), true);
+    ColumnReference collectionColumn = column_reference_from_key_path(key_path(objectSchema, [subqueryExpression.collection keyPath]), true);
     RLMObjectSchema *collectionMemberObjectSchema = m_schema[collectionColumn.property().objectClassName];
 
     // Eliminate references to the iteration variable in the subquery.
@@ -1752,6 +1847,13 @@ void QueryBuilder::apply_function_expression(RLMObjectSchema *objectSchema, NSEx
 
 void QueryBuilder::apply_predicate(NSPredicate *predicate, RLMObjectSchema *objectSchema)
 {
+    // Predicates built by the Swift query API
+    if (auto expression = RLMDynamicCast<RLMQueryExpression>(predicate)) {
+        QueryExpressionReader reader(expression);
+        apply_expression(reader, objectSchema);
+        return;
+    }
+
     // Compound predicates.
     if ([predicate isMemberOfClass:[NSCompoundPredicate class]]) {
         NSCompoundPredicate *comp = (NSCompoundPredicate *)predicate;
@@ -1828,18 +1930,18 @@ void QueryBuilder::apply_predicate(NSPredicate *predicate, RLMObjectSchema *obje
 
         if (exp1Type == NSKeyPathExpressionType && exp2Type == NSKeyPathExpressionType) {
             // both expression are KeyPaths
-            apply_column_expression(key_path_from_string(m_schema, objectSchema, compp.leftExpression.keyPath),
-                                    key_path_from_string(m_schema, objectSchema, compp.rightExpression.keyPath),
+            apply_column_expression(key_path(objectSchema, compp.leftExpression.keyPath),
+                                    key_path(objectSchema, compp.rightExpression.keyPath),
                                     compp);
         }
         else if (exp1Type == NSKeyPathExpressionType && exp2Type == NSConstantValueExpressionType) {
             // comparing keypath to value
-            apply_value_expression(key_path_from_string(m_schema, objectSchema, compp.leftExpression.keyPath),
+            apply_value_expression(key_path(objectSchema, compp.leftExpression.keyPath),
                                    compp.rightExpression.constantValue, compp);
         }
         else if (exp1Type == NSConstantValueExpressionType && exp2Type == NSKeyPathExpressionType) {
             // comparing value to keypath
-            apply_value_expression(key_path_from_string(m_schema, objectSchema, compp.rightExpression.keyPath),
+            apply_value_expression(key_path(objectSchema, compp.rightExpression.keyPath),
                                    compp.leftExpression.constantValue, compp);
         }
         else if (exp1Type == NSFunctionExpressionType) {
@@ -1870,6 +1972,96 @@ void QueryBuilder::apply_predicate(NSPredicate *predicate, RLMObjectSchema *obje
     }
 }
 
+void QueryBuilder::apply_expression(QueryExpressionReader& reader, RLMObjectSchema *objectSchema)
+{
+    switch (reader.next()) {
+        case RLMQueryInstructionTrue:
+            m_query.and_query(std::unique_ptr<Expression>(new TrueExpression));
+            break;
+
+        case RLMQueryInstructionAnd:
+            m_query.group();
+            apply_expression(reader, objectSchema);
+            apply_expression(reader, objectSchema);
+            m_query.end_group();
+            break;
+
+        case RLMQueryInstructionOr:
+            m_query.group();
+            apply_expression(reader, objectSchema);
+            m_query.Or();
+            apply_expression(reader, objectSchema);
+            m_query.end_group();
+            break;
+
+        case RLMQueryInstructionNot:
+            m_query.Not();
+            apply_expression(reader, objectSchema);
+            break;
+
+        case RLMQueryInstructionCompare: {
+            auto type = static_cast<NSPredicateOperatorType>(reader.next());
+            auto options = static_cast<NSComparisonPredicateOptions>(reader.next());
+            auto modifier = static_cast<NSComparisonPredicateModifier>(reader.next());
+            RLMPrecondition(modifier != NSAllPredicateModifier,
+                            @"Invalid predicate", @"ALL modifier not supported");
+
+            // Each operand is either a key path or a constant value
+            auto read_operand = [&](NSString *__strong& keyPath, __strong id& value) {
+                auto kind = reader.next();
+                auto index = reader.next();
+                if (kind == RLMQueryInstructionKeyPath) {
+                    keyPath = reader.key_path(index);
+                }
+                else {
+                    RLMPrecondition(kind == RLMQueryInstructionConstant, @"Invalid predicate",
+                                    @"Invalid query expression operand");
+                    value = reader.value(index);
+                }
+            };
+            NSString *leftKeyPath, *rightKeyPath;
+            id leftValue, rightValue;
+            read_operand(leftKeyPath, leftValue);
+            read_operand(rightKeyPath, rightValue);
+
+            if (type == NSInPredicateOperatorType && !leftKeyPath && rightKeyPath) {
+                // "%@ IN key.path" is equivalent to "ANY key.path == %@"
+                apply_value_expression(key_path(objectSchema, rightKeyPath), leftValue,
+                                       Comparison(NSEqualToPredicateOperatorType, 0, NSAnyPredicateModifier, true));
+            }
+            else if ((type == NSBetweenPredicateOperatorType || type == NSInPredicateOperatorType) && !(leftKeyPath && !rightKeyPath)) {
+                if (type == NSBetweenPredicateOperatorType) {
+                    throwException(@"Invalid predicate",
+                                   @"Predicate with BETWEEN operator must compare a KeyPath with an aggregate with two values");
+                }
+                throwException(@"Invalid predicate",
+                               @"Predicate with IN operator must compare a KeyPath with an aggregate");
+            }
+            else if (leftKeyPath && rightKeyPath) {
+                apply_column_expression(key_path(objectSchema, leftKeyPath),
+                                        key_path(objectSchema, rightKeyPath),
+                                        Comparison(type, options, modifier, true));
+            }
+            else if (leftKeyPath) {
+                apply_value_expression(key_path(objectSchema, leftKeyPath), rightValue,
+                                       Comparison(type, options, modifier, true));
+            }
+            else if (rightKeyPath) {
+                apply_value_expression(key_path(objectSchema, rightKeyPath), leftValue,
+                                       Comparison(type, options, modifier, false));
+            }
+            else {
+                throwException(@"Invalid predicate expressions",
+                               @"Predicate expressions must compare a keypath and another keypath or a constant value");
+            }
+            break;
+        }
+
+        default:
+            throwException(@"Invalid predicate", @"Invalid query expression instruction");
+    }
+}
+
 // This function returns the nested subscripts from a NSPredicate with the following format `anyCol[0]['key'][#any]`
 // and its respective keypath (including any linked keypath)
 // This will iterate each argument of the NSExpression and its nested NSExpressions, takes the constant subscript
@@ -1910,10 +2102,9 @@ NSString* QueryBuilder::get_path_elements(std::vector<PathElement> &paths, NSExp
 
     return keyPath;
 }
-} // namespace
 
-realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMObjectSchema *objectSchema,
-                                 RLMSchema *schema, Group &group)
+Query predicate_to_query(NSPredicate *predicate, RLMObjectSchema *objectSchema,
+                         RLMSchema *schema, Group &group, RLMQueryCache::Plan *plan)
 {
     auto query = get_table(group, objectSchema).where();
 
@@ -1924,7 +2115,7 @@ realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMObjectSchema *object
 
     try {
         @autoreleasepool {
-            QueryBuilder(query, group, schema).apply_predicate(predicate, objectSchema);
+            QueryBuilder(query, group, schema, plan).apply_predicate(predicate, objectSchema);
         }
     }
     catch (std::exception const& e) {
@@ -1933,6 +2124,204 @@ realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMObjectSchema *object
 
     return query;
 }
+} // namespace
+
+realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMObjectSchema *objectSchema,
+                                 RLMSchema *schema, Group &group)
+{
+    return predicate_to_query(predicate, objectSchema, schema, group, nullptr);
+}
+
+#pragma mark - Query Cache
+
+namespace {
+std::atomic<size_t> s_queryCacheCapacity{32};
+std::atomic<size_t> s_queryCacheHits{0};
+std::atomic<size_t> s_queryCacheMisses{0};
+
+// Append a description of the structure of the predicate to the shape, leaving
+// out the values of constants, returning false if the predicate contains
+// something which the shape can't describe
+bool appendPredicateShape(std::string& shape, NSPredicate *predicate);
+
+void appendKeyPathShape(std::string& shape, NSString *keyPath) {
+    shape += keyPath.UTF8String ?: "";
+    shape += '\0';
+}
+
+bool appendExpressionShape(std::string& shape, NSExpression *expression) {
+    switch (expression.expressionType) {
+        case NSConstantValueExpressionType:
+            shape += 'c';
+            return true;
+        case NSEvaluatedObjectExpressionType:
+            shape += 'e';
+            return true;
+        case NSKeyPathExpressionType:
+            shape += 'k';
+            appendKeyPathShape(shape, expression.keyPath);
+            return true;
+        case NSVariableExpressionType:
+            shape += 'v';
+            appendKeyPathShape(shape, expression.variable);
+            return true;
+        case NSAnyKeyExpressionType:
+            shape += 'a';
+            return true;
+        case NSFunctionExpressionType:
+            shape += 'f';
+            appendKeyPathShape(shape, expression.function);
+            if (expression.operand && !appendExpressionShape(shape, expression.operand)) {
+                return false;
+            }
+            shape += '(';
+            for (NSExpression *argument in expression.arguments) {
+                if (!appendExpressionShape(shape, argument)) {
+                    return false;
+                }
+            }
+            shape += ')';
+            return true;
+        case NSAggregateExpressionType: {
+            id collection = expression.collection;
+            if (![collection isKindOfClass:[NSArray class]]) {
+                shape += 'c';
+                return true;
+            }
+            shape += '{';
+            for (id element in collection) {
+                if (![element isKindOfClass:[NSExpression class]]) {
+                    shape += 'c';
+                }
+                else if (!appendExpressionShape(shape, element)) {
+                    return false;
+                }
+            }
+            shape += '}';
+            return true;
+        }
+        case NSSubqueryExpressionType:
+            shape += 's';
+            appendKeyPathShape(shape, expression.variable);
+            return appendExpressionShape(shape, expression.collection)
+                && appendPredicateShape(shape, expression.predicate);
+        case NSUnionSetExpressionType:
+        case NSIntersectSetExpressionType:
+        case NSMinusSetExpressionType:
+            shape += 'u';
+            shape += std::to_string(expression.expressionType);
+            return appendExpressionShape(shape, expression.leftExpression)
+                && appendExpressionShape(shape, expression.rightExpression);
+        default:
+            return false;
+    }
+}
+
+bool appendPredicateShape(std::string& shape, NSPredicate *predicate) {
+    if (auto compound = RLMDynamicCast<NSCompoundPredicate>(predicate)) {
+        shape += std::to_string(compound.compoundPredicateType);
+        shape += '(';
+        for (NSPredicate *subpredicate in compound.subpredicates) {
+            if (!appendPredicateShape(shape, subpredicate)) {
+                return false;
+            }
+        }
+        shape += ')';
+        return true;
+    }
+    if (auto comparison = RLMDynamicCast<NSComparisonPredicate>(predicate)) {
+        shape += '=';
+        shape += std::to_string(comparison.predicateOperatorType);
+        shape += ',';
+        shape += std::to_string(comparison.options);
+        shape += ',';
+        shape += std::to_string(comparison.comparisonPredicateModifier);
+        return appendExpressionShape(shape, comparison.leftExpression)
+            && appendExpressionShape(shape, comparison.rightExpression);
+    }
+    if (auto expression = RLMDynamicCast<RLMQueryExpression>(predicate)) {
+        // The instructions hold the operators and the indexes of the key paths
+        // and values, but not the values themselves
+        shape += 'q';
+        shape.append(static_cast<const char *>(expression.instructions.bytes),
+                     expression.instructions.length);
+        for (NSString *keyPath in expression.keyPaths) {
+            appendKeyPathShape(shape, keyPath);
+        }
+        return true;
+    }
+    // TRUEPREDICATE and FALSEPREDICATE are cheap to compile, and block
+    // predicates are rejected by the query builder
+    return false;
+}
+} // anonymous namespace
+
+realm::Query RLMQueryCache::get(NSPredicate *predicate, RLMObjectSchema *objectSchema,
+                                RLMSchema *schema, Group& group) {
+    size_t capacity = s_queryCacheCapacity.load(std::memory_order_relaxed);
+    std::string shape;
+    if (capacity == 0 || !appendPredicateShape(shape, predicate)) {
+        return predicate_to_query(predicate, objectSchema, schema, group, nullptr);
+    }
+
+    if (auto it = m_index.find(shape); it != m_index.end()) {
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        s_queryCacheHits.fetch_add(1, std::memory_order_relaxed);
+        // Hold a reference in case compiling the query clears the cache
+        auto plan = it->second->second;
+        return predicate_to_query(predicate, objectSchema, schema, group, plan.get());
+    }
+
+    s_queryCacheMisses.fetch_add(1, std::memory_order_relaxed);
+    auto plan = std::make_shared<Plan>();
+    auto query = predicate_to_query(predicate, objectSchema, schema, group, plan.get());
+    // Only cache the plan once compiling with it has succeeded, as an invalid
+    // predicate may have stopped partway through
+    plan->complete = true;
+    m_entries.emplace_front(std::move(shape), std::move(plan));
+    m_index.emplace(m_entries.front().first, m_entries.begin());
+    while (m_entries.size() > capacity) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+    return query;
+}
+
+void RLMQueryCache::clear() {
+    m_index.clear();
+    m_entries.clear();
+}
+
+realm::Query RLMPredicateToQuery(NSPredicate *predicate, RLMClassInfo& info) {
+    if (!predicate) {
+        return RLMPredicateToQuery(predicate, info.rlmObjectSchema, info.realm.schema, info.realm.group);
+    }
+    if (!info.queryCache) {
+        info.queryCache = std::make_shared<RLMQueryCache>();
+    }
+    return info.queryCache->get(predicate, info.rlmObjectSchema, info.realm.schema, info.realm.group);
+}
+
+size_t RLMGetQueryCacheCapacity() {
+    return s_queryCacheCapacity.load(std::memory_order_relaxed);
+}
+
+void RLMSetQueryCacheCapacity(size_t capacity) {
+    s_queryCacheCapacity.store(capacity, std::memory_order_relaxed);
+}
+
+size_t RLMGetQueryCacheHitCount() {
+    return s_queryCacheHits.load(std::memory_order_relaxed);
+}
+
+size_t RLMGetQueryCacheMissCount() {
+    return s_queryCacheMisses.load(std::memory_order_relaxed);
+}
+
+void RLMResetQueryCacheStatistics() {
+    s_queryCacheHits.store(0, std::memory_order_relaxed);
+    s_queryCacheMisses.store(0, std::memory_order_relaxed);
+}
 
 // return the property for a validated column name
 RLMProperty *RLMValidatedProperty(RLMObjectSchema *desc, NSString *columnName) {
@@ -1941,3 +2330,76 @@ RLMProperty *RLMValidatedProperty(RLMObjectSchema *desc, NSString *columnName) {
                     @"Property '%@' not found in object of type '%@'", columnName, desc.className);
     return prop;
 }
+
+@implementation RLMQueryExpression {
+    NSPredicate *(^_predicateBuilder)(void);
+    NSPredicate *_predicate;
+}
+
+- (instancetype)initWithInstructions:(NSData *)instructions
+                            keyPaths:(NSArray<NSString *> *)keyPaths
+                              values:(NSArray *)values
+                    predicateBuilder:(NSPredicate *(^)(void))predicateBuilder {
+    if ((self = [super init])) {
+        _instructions = instructions;
+        _keyPaths = keyPaths;
+        _values = values;
+        _predicateBuilder = predicateBuilder;
+    }
+    return self;
+}
+
+- (NSPredicate *)predicate {
+    @synchronized (self) {
+        if (!_predicate) {
+            _predicate = _predicateBuilder();
+            _predicateBuilder = nil;
+        }
+        return _predicate;
+    }
+}
+
+- (BOOL)evaluateWithObject:(id)object substitutionVariables:(NSDictionary<NSString *, id> *)bindings {
+    return [self.predicate evaluateWithObject:object substitutionVariables:bindings];
+}
+
+- (instancetype)predicateWithSubstitutionVariables:(NSDictionary<NSString *, id> *)variables {
+    return (id)[self.predicate predicateWithSubstitutionVariables:variables];
+}
+
+- (NSString *)predicateFormat {
+    return self.predicate.predicateFormat;
+}
+
+- (NSString *)description {
+    return self.predicate.description;
+}
+
+- (void)allowEvaluation {
+    [self.predicate allowEvaluation];
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+- (id)replacementObjectForCoder:(NSCoder *)coder {
+    return self.predicate;
+}
+
+- (BOOL)isEqual:(id)object {
+    if (self == object) {
+        return YES;
+    }
+    if (auto other = RLMDynamicCast<RLMQueryExpression>(object)) {
+        return [_instructions isEqualToData:other->_instructions]
+            && [_keyPaths isEqualToArray:other->_keyPaths]
+            && [_values isEqualToArray:other->_values];
+    }
+    return NO;
+}
+
+- (NSUInteger)hash {
+    return _instructions.hash ^ _keyPaths.hash ^ _values.hash;
+}
+@end
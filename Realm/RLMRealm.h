@@ -18,7 +18,7 @@
 
 #import <Realm/RLMConstants.h>
 
-@class RLMRealmConfiguration, RLMRealm, RLMObject, RLMSchema, RLMMigration, RLMNotificationToken, RLMThreadSafeReference, RLMAsyncOpenTask, RLMSyncSubscriptionSet;
+@class RLMRealmConfiguration, RLMRealm, RLMObject, RLMSchema, RLMMigration, RLMNotificationToken, RLMThreadSafeReference, RLMAsyncOpenTask, RLMSyncSubscriptionSet, RLMJSONImportOptions;
 
 /**
  A callback block for opening Realms asynchronously.
@@ -861,6 +861,47 @@ NS_REFINED_FOR_SWIFT;
  */
 - (void)deleteAllObjects;
 
+/**
+ Imports objects of the given type from a stream of JSON.
+
+ The stream may contain either a single JSON array of objects, or a sequence
+ of JSON objects separated by whitespace such as newline-delimited JSON. Each
+ object's keys are the names of the persisted properties of the class. The
+ stream is parsed incrementally and values are written directly to the
+ Realm's table without creating `RLMObject` instances, so memory usage does not
+ grow with the size of the input.
+
+ Dates may be given either as a number of seconds since 1970 or as an ISO 8601
+ string, `NSData` properties as base64-encoded strings, and `RLMObjectId`,
+ `RLMDecimal128` and `NSUUID` properties as their string representations.
+ Properties which are missing from an object are set to their default values
+ for newly created objects and left unchanged for updated objects.
+
+ If called outside of a write transaction, the objects are imported in a series
+ of write transactions of `options.objectsPerTransaction` objects each. If an
+ error occurs, the current transaction is cancelled but objects from earlier
+ transactions remain in the Realm. If called within a write transaction, all
+ objects are written in that transaction and it is not committed. If an error
+ occurs in this case the transaction is left open: objects before the invalid
+ one have been written to it and the invalid object is not created, although
+ linked objects created for it may remain. Cancel the transaction to discard
+ the partial import.
+
+ @param className The name of the object type to import.
+ @param stream    The stream to read from. It is opened and closed by this
+                  method if it has not already been opened.
+ @param options   Options controlling the import, or `nil` to use the defaults.
+ @param error     If an error occurs, upon return contains an `NSError` object
+                  that describes the problem. If you are not interested in
+                  possible errors, pass in `NULL`.
+
+ @return Whether the import succeeded.
+ */
+- (BOOL)importObjectsOfClass:(NSString *)className
+              fromJSONStream:(NSInputStream *)stream
+                     options:(nullable RLMJSONImportOptions *)options
+                       error:(NSError **)error;
+
 #pragma mark - Sync Subscriptions
 
 /**
@@ -914,6 +955,36 @@ NS_REFINED_FOR_SWIFT;
  */
 + (BOOL)performMigrationForConfiguration:(RLMRealmConfiguration *)configuration error:(NSError **)error;
 
+#pragma mark - Query Cache
+
+/**
+ The maximum number of predicate shapes retained for each object type by each
+ Realm instance.
+
+ Converting an `NSPredicate` to a query is a significant part of the cost of
+ filtering. When a predicate with the same shape as one which was recently used
+ to filter objects of the same type is used again, the key paths which were
+ resolved and validated for the earlier predicate are reused. Two predicates
+ have the same shape if they have the same operators, options and key paths,
+ regardless of their constant values, so `age > 18` and `age > 21` share an
+ entry. The constant values are always read from the predicate being used. The
+ cache is emptied when a Realm is invalidated.
+
+ Defaults to 32. Setting this to zero disables the cache.
+ */
+@property (class, nonatomic) NSUInteger queryCacheCapacity;
+
+/// The number of times the key paths resolved for a predicate of the same shape
+/// were reused since the last call to `+resetQueryCacheStatistics`.
+@property (class, nonatomic, readonly) NSUInteger queryCacheHitCount;
+
+/// The number of times a cacheable predicate's key paths had to be resolved
+/// since the last call to `+resetQueryCacheStatistics`.
+@property (class, nonatomic, readonly) NSUInteger queryCacheMissCount;
+
+/// Resets `queryCacheHitCount` and `queryCacheMissCount` to zero.
++ (void)resetQueryCacheStatistics;
+
 #pragma mark - Unavailable Methods
 
 /**
@@ -959,4 +1030,33 @@ RLM_SWIFT_SENDABLE // is internally thread-safe
 - (void)stop __attribute__((unavailable("Renamed to -invalidate."))) NS_REFINED_FOR_SWIFT;
 @end
 
+// MARK: - RLMJSONImportOptions
+
+/**
+ Options for `-[RLMRealm importObjectsOfClass:fromJSONStream:options:error:]`.
+ */
+@interface RLMJSONImportOptions : NSObject <NSCopying>
+
+/**
+ Whether objects whose primary key matches an existing object should update
+ that object. If `NO`, importing a duplicate primary key is an error. Defaults
+ to `NO`. Requires that the class have a primary key.
+ */
+@property (nonatomic) BOOL updateExisting;
+
+/**
+ Whether keys which do not correspond to a persisted property should be
+ skipped. If `NO`, an unknown key is an error. Defaults to `NO`.
+ */
+@property (nonatomic) BOOL ignoreUnknownKeys;
+
+/**
+ The number of objects to write in each write transaction when the import is
+ not performed inside an existing write transaction. Zero means that all
+ objects are written in a single transaction. Defaults to 10,000.
+ */
+@property (nonatomic) NSUInteger objectsPerTransaction;
+
+@end
+
 RLM_HEADER_AUDIT_END(nullability, sendability)
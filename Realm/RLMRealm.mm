@@ -23,6 +23,7 @@
 #import "RLMArray_Private.hpp"
 #import "RLMDictionary_Private.hpp"
 #import "RLMError_Private.hpp"
+#import "RLMJSONImport.hpp"
 #import "RLMLogger.h"
 #import "RLMMigration_Private.h"
 #import "RLMObject_Private.h"
@@ -53,6 +54,8 @@
 #import <realm/util/scope_exit.hpp>
 #import <realm/version.hpp>
 
+#import <atomic>
+
 #if REALM_ENABLE_SYNC
 #import "RLMSyncManager_Private.hpp"
 #import "RLMSyncSession_Private.hpp"
@@ -249,11 +252,11 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
 }
 
 + (void)runFirstCheckForConfiguration:(RLMRealmConfiguration *)configuration schema:(RLMSchema *)schema {
-    static bool initialized;
-    if (initialized) {
+    // Realms for different files may be opened concurrently
+    static std::atomic<bool> initialized;
+    if (initialized.exchange(true)) {
         return;
     }
-    initialized = true;
 
     // Run Analytics on the very first any Realm open.
     RLMSendAnalytics(configuration, schema);
@@ -418,9 +421,10 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     realm->_dynamic = dynamic;
     realm->_actor = scheduler.actor;
 
-    // protects the realm cache and accessors cache
-    static auto& initLock = *new RLMUnfairMutex;
-    std::lock_guard lock(initLock);
+    // Opening a file can update its schema, so opens of the same file are
+    // serialized. Opens of other files proceed concurrently.
+    auto openLock = RLMGetRealmOpenLock(config.path);
+    std::lock_guard lock(*openLock);
 
     try {
         config.scheduler = scheduler.osScheduler;
@@ -795,6 +799,9 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     _realm->invalidate();
 
     for (auto& objectInfo : _info) {
+        if (objectInfo.second.queryCache) {
+            objectInfo.second.queryCache->clear();
+        }
         for (RLMObservationInfo *info : objectInfo.second.observedObjects) {
             info->didChange(RLMInvalidatedKey);
         }
@@ -874,13 +881,7 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
 }
 
 - (void)addObjects:(id<NSFastEnumeration>)objects {
-    for (RLMObject *obj in objects) {
-        if (![obj isKindOfClass:RLMObjectBase.class]) {
-            @throw RLMException(@"Cannot insert objects of type %@ with addObjects:. Only RLMObjects are supported.",
-                                NSStringFromClass(obj.class));
-        }
-        [self addObject:obj];
-    }
+    RLMAddObjectsToRealm(objects, self, RLMUpdatePolicyError);
 }
 
 - (void)addOrUpdateObject:(RLMObject *)object {
@@ -893,14 +894,15 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
 }
 
 - (void)addOrUpdateObjects:(id<NSFastEnumeration>)objects {
-    for (RLMObject *obj in objects) {
-        if (![obj isKindOfClass:RLMObjectBase.class]) {
-            @throw RLMException(@"Cannot add or update objects of type %@ with addOrUpdateObjects:. Only RLMObjects are"
-                                " supported.",
-                                NSStringFromClass(obj.class));
-        }
-        [self addOrUpdateObject:obj];
-    }
+    RLMAddObjectsToRealm(objects, self, RLMUpdatePolicyUpdateAll);
+}
+
+- (BOOL)importObjectsOfClass:(NSString *)className
+              fromJSONStream:(NSInputStream *)stream
+                     options:(RLMJSONImportOptions *)options
+                       error:(NSError **)error {
+    [self verifyThread];
+    return RLMImportObjectsFromJSONStream(self, className, stream, options, error);
 }
 
 - (void)deleteObject:(RLMObject *)object {
@@ -935,18 +937,10 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
             @throw RLMException(@"Cannot delete objects from RLMDictionary of type %@: only RLMObjects can be deleted.",
                                 RLMTypeToString(dictionary.type));
         }
-        for (RLMObject *obj in dictionary.allValues) {
-            RLMDeleteObjectFromRealm(obj, self);
-        }
+        RLMDeleteObjectsFromRealm(dictionary.allValues, self);
         return;
     }
-    for (RLMObject *obj in objects) {
-        if (![obj isKindOfClass:RLMObjectBase.class]) {
-            @throw RLMException(@"Cannot delete objects of type %@ with deleteObjects:. Only RLMObjects can be deleted.",
-                                NSStringFromClass(obj.class));
-        }
-        RLMDeleteObjectFromRealm(obj, self);
-    }
+    RLMDeleteObjectsFromRealm(objects, self);
 }
 
 - (void)deleteAllObjects {
@@ -1017,6 +1011,26 @@ bool copySeedFile(RLMRealmConfiguration *configuration, NSError **error) {
     return success;
 }
 
++ (NSUInteger)queryCacheCapacity {
+    return RLMGetQueryCacheCapacity();
+}
+
++ (void)setQueryCacheCapacity:(NSUInteger)capacity {
+    RLMSetQueryCacheCapacity(capacity);
+}
+
++ (NSUInteger)queryCacheHitCount {
+    return RLMGetQueryCacheHitCount();
+}
+
++ (NSUInteger)queryCacheMissCount {
+    return RLMGetQueryCacheMissCount();
+}
+
++ (void)resetQueryCacheStatistics {
+    RLMResetQueryCacheStatistics();
+}
+
 - (RLMObject *)createObject:(NSString *)className withValue:(id)value {
     return (RLMObject *)RLMCreateObjectInRealmWithValue(self, className, value, RLMUpdatePolicyError);
 }
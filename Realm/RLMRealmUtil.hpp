@@ -22,6 +22,7 @@
 #import <string>
 
 @class RLMRealm, RLMRealmConfiguration, RLMScheduler;
+class RLMUnfairMutex;
 
 namespace realm {
     class BindingContext;
@@ -35,6 +36,10 @@ RLMRealm *RLMGetAnyCachedRealmForPath(std::string const& path) NS_RETURNS_RETAIN
 // Clear the weak cache of Realms
 void RLMClearRealmCache();
 
+// Get the lock which serializes opening the Realm file at the given path.
+// Opens of different files do not block each other.
+std::shared_ptr<RLMUnfairMutex> RLMGetRealmOpenLock(std::string const& path);
+
 RLMRealm *RLMGetFrozenRealmForSourceRealm(RLMRealm *realm) NS_RETURNS_RETAINED;
 
 std::unique_ptr<realm::BindingContext> RLMCreateBindingContext(RLMRealm *realm);
@@ -31,11 +31,14 @@
 #import <realm/object-store/util/scheduler.hpp>
 
 #import <map>
+#import <unordered_map>
 
 // Global realm state
 static auto& s_realmCacheMutex = *new RLMUnfairMutex;
 static auto& s_realmsPerPath = *new std::map<std::string, NSMapTable *>();
 static auto& s_frozenRealms = *new std::map<std::string, NSMapTable *>();
+static auto& s_openLocksMutex = *new RLMUnfairMutex;
+static auto& s_openLocks = *new std::unordered_map<std::string, std::weak_ptr<RLMUnfairMutex>>();
 
 void RLMCacheRealm(__unsafe_unretained RLMRealmConfiguration *const configuration,
                    RLMScheduler *scheduler,
@@ -84,6 +87,22 @@ void RLMClearRealmCache() {
     s_frozenRealms.clear();
 }
 
+std::shared_ptr<RLMUnfairMutex> RLMGetRealmOpenLock(std::string const& path) {
+    std::lock_guard lock(s_openLocksMutex);
+    if (auto it = s_openLocks.find(path); it != s_openLocks.end()) {
+        if (auto mutex = it->second.lock()) {
+            return mutex;
+        }
+    }
+
+    // Locks only live as long as an open of their path is in progress, so
+    // discard the entries for any which have finished
+    std::erase_if(s_openLocks, [](auto const& entry) { return entry.second.expired(); });
+    auto mutex = std::make_shared<RLMUnfairMutex>();
+    s_openLocks[path] = mutex;
+    return mutex;
+}
+
 RLMRealm *RLMGetFrozenRealmForSourceRealm(__unsafe_unretained RLMRealm *const sourceRealm) {
     std::lock_guard lock(s_realmCacheMutex);
     auto& r = *sourceRealm->_realm;
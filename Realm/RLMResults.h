@@ -17,6 +17,7 @@
 ////////////////////////////////////////////////////////////////////////////
 
 #import <Realm/RLMCollection.h>
+#import <Realm/RLMLogger.h>
 
 RLM_HEADER_AUDIT_BEGIN(nullability, sendability)
 
@@ -39,7 +40,28 @@ typedef NS_ENUM(NSUInteger, RLMWaitForSyncMode) {
     RLMWaitForSyncModeNever
 } NS_SWIFT_NAME(WaitForSyncMode);
 
-@class RLMObject;
+/**
+ The aggregates of a single property computed by
+ `-[RLMResults aggregateProperties:into:]`.
+ */
+typedef struct RLMAggregateResult {
+    /// The number of objects with a non-null value for the property.
+    NSUInteger count;
+    /// The minimum value, or `NAN` if there are no non-null values. Stored
+    /// `NAN` values are ignored.
+    double min;
+    /// The maximum value, or `NAN` if there are no non-null values. Stored
+    /// `NAN` values are ignored.
+    double max;
+    /// The sum of the values, or `0` if there are no non-null values. This is
+    /// `NAN` if any of the values are `NAN`.
+    double sum;
+    /// The average of the values, or `NAN` if there are no non-null values or
+    /// any of the values are `NAN`.
+    double average;
+} RLMAggregateResult NS_SWIFT_NAME(AggregateResult);
+
+@class RLMObject, RLMDescriptionOptions;
 
 /**
  `RLMResults` is an auto-updating container type in Realm returned from object
@@ -144,6 +166,25 @@ typedef NS_ENUM(NSUInteger, RLMWaitForSyncMode) {
  */
 - (nullable RLMObjectType)lastObject;
 
+/**
+ Returns an object which can be used with fast enumeration to iterate over the
+ objects in the results collection without creating a new object for each
+ element.
+
+ Enumerating the returned object reuses a pool of objects which are updated to
+ refer to the next batch of elements as the enumeration progresses, and
+ produces elements in increasingly large batches. This avoids most of the
+ per-object allocation cost of enumerating a large results collection.
+
+ @warning The objects produced by the enumeration must not be retained, stored,
+          or observed outside of the body of the loop, as they will be changed
+          to refer to different objects later in the enumeration. Use normal
+          fast enumeration if the objects need to be kept.
+
+ @return An object which can be enumerated with `for...in`.
+ */
+- (id<NSFastEnumeration>)objectsReusingAccessors;
+
 #pragma mark - Querying Results
 
 /**
@@ -647,6 +688,107 @@ __attribute__((swift_attr("@_unsafeInheritExecutor")));
 /// :nodoc:
 - (RLMObjectType)objectAtIndexedSubscript:(NSUInteger)index;
 
+#pragma mark - Reading Property Values in Bulk
+
+/**
+ Copies the values of an `int` property for the objects in the given range of
+ the results collection into a buffer.
+
+ Unlike `valueForKey:`, this reads the values directly from the Realm file
+ without creating an object for each element or boxing the values in
+ `NSNumber`s. `null` values are written as `0`.
+
+ @warning This method may only be called on results collections of objects.
+
+ @param property The name of the property to read. Must be an `int` property.
+ @param buffer   A buffer with space for at least `range.length` values.
+ @param range    The range of objects in the results collection to read.
+ */
+- (void)readInt64Column:(NSString *)property into:(int64_t *)buffer range:(NSRange)range
+NS_SWIFT_NAME(readInt64Column(_:into:range:));
+
+/**
+ Copies the values of a `double` property for the objects in the given range
+ of the results collection into a buffer. `null` values are written as `NAN`.
+
+ @see `readInt64Column:into:range:`
+ */
+- (void)readDoubleColumn:(NSString *)property into:(double *)buffer range:(NSRange)range
+NS_SWIFT_NAME(readDoubleColumn(_:into:range:));
+
+/**
+ Copies the values of a `float` property for the objects in the given range
+ of the results collection into a buffer. `null` values are written as `NAN`.
+
+ @see `readInt64Column:into:range:`
+ */
+- (void)readFloatColumn:(NSString *)property into:(float *)buffer range:(NSRange)range
+NS_SWIFT_NAME(readFloatColumn(_:into:range:));
+
+/**
+ Copies the values of a `bool` property for the objects in the given range of
+ the results collection into a buffer. `null` values are written as `false`.
+
+ @see `readInt64Column:into:range:`
+ */
+- (void)readBoolColumn:(NSString *)property into:(bool *)buffer range:(NSRange)range
+NS_SWIFT_NAME(readBoolColumn(_:into:range:));
+
+/**
+ Copies the values of an `NSDate` property for the objects in the given range
+ of the results collection into a buffer, as time intervals relative to the
+ reference date (00:00:00 UTC on 1 January 2001). `null` values are written as
+ `NAN`.
+
+ @see `readInt64Column:into:range:`
+ */
+- (void)readTimestampColumn:(NSString *)property into:(NSTimeInterval *)buffer range:(NSRange)range
+NS_SWIFT_NAME(readTimestampColumn(_:into:range:));
+
+/**
+ Copies the values of an `NSString` property for the objects in the given
+ range of the results collection into a buffer. `null` values are written as
+ `nil`.
+
+ The buffer holds `__strong` references and each value is stored with a
+ strong assignment which releases the previous value, so the buffer must
+ already be initialized, such as by zero-filling it or creating it with
+ `calloc()`, and the values must be released by setting each element to `nil`
+ before a heap-allocated buffer is freed.
+
+ @see `readInt64Column:into:range:`
+ */
+- (void)readStringColumn:(NSString *)property
+                    into:(NSString *__strong _Nullable *_Nonnull)buffer
+                   range:(NSRange)range
+NS_SWIFT_NAME(readStringColumn(_:into:range:));
+
+#pragma mark - Aggregating Multiple Properties
+
+/**
+ Computes the count, minimum, maximum, sum and average of each of the given
+ properties over the objects represented by the results collection.
+
+ All of the aggregates are computed in a single pass over the results, so this
+ is much faster than calling `minOfProperty:`, `maxOfProperty:`,
+ `sumOfProperty:` and `averageOfProperty:` separately when several aggregates
+ are needed. `null` values are excluded from every aggregate. `int` values are
+ converted to `double`, so sums of very large values may lose precision.
+
+     RLMAggregateResult aggregates[2];
+     [results aggregateProperties:@[@"age", @"weight"] into:aggregates];
+
+ @warning This method may only be called on results collections of objects.
+
+ @param properties The names of the properties to aggregate. Only properties of
+                   types `int`, `float`, and `double` are supported.
+ @param results    A buffer with space for at least `properties.count` values,
+                   which is filled with the aggregates for each property in
+                   the same order as `properties`.
+ */
+- (void)aggregateProperties:(NSArray<NSString *> *)properties into:(RLMAggregateResult *)results
+NS_SWIFT_NAME(aggregateProperties(_:into:));
+
 #pragma mark - Sectioned Results
 
 /**
@@ -679,6 +821,46 @@ __attribute__((swift_attr("@_unsafeInheritExecutor")));
 - (RLMSectionedResults *)sectionedResultsUsingSortDescriptors:(NSArray<RLMSortDescriptor *> *)sortDescriptors
                                                      keyBlock:(RLMSectionedResultsKeyBlock)keyBlock;
 
+#pragma mark - Writing Descriptions
+
+/**
+ Writes a description of the objects in the results collection to a file
+ descriptor.
+
+ The description is produced incrementally, with output buffered and written
+ as each object is completed, so the memory used does not grow with the size
+ of the results collection. This makes it suitable for dumping large
+ collections for debugging where building `description` would not be.
+
+ @param fileDescriptor An open file descriptor to write to. The file descriptor
+                       is not closed.
+ @param options        Options controlling the format and how much of the
+                       collection is written, or `nil` to use the defaults.
+ @param error          If writing to the file descriptor fails, upon return
+                       contains an `NSError` in `NSPOSIXErrorDomain`
+                       describing the problem.
+
+ @return Whether the description was written successfully.
+ */
+- (BOOL)writeDescriptionToFileDescriptor:(int)fileDescriptor
+                                 options:(nullable RLMDescriptionOptions *)options
+                                   error:(NSError **)error;
+
+/**
+ Writes a description of the objects in the results collection to a logger.
+
+ Each top-level object is logged as a separate message. Nothing is done if the
+ logger is not configured to log messages at the given level.
+
+ @param logger  The logger to write to.
+ @param level   The level to log the messages at.
+ @param options Options controlling the format and how much of the collection
+                is written, or `nil` to use the defaults.
+ */
+- (void)writeDescriptionToLogger:(RLMLogger *)logger
+                           level:(RLMLogLevel)level
+                         options:(nullable RLMDescriptionOptions *)options;
+
 #pragma mark - Freeze
 
 /**
@@ -741,4 +923,43 @@ __attribute__((swift_attr("@_unsafeInheritExecutor")));
 @interface RLMLinkingObjects<RLMObjectType: RLMObject *> : RLMResults
 @end
 
+/**
+ Options for `-[RLMResults writeDescriptionToFileDescriptor:options:error:]`
+ and `-[RLMResults writeDescriptionToLogger:level:options:]`.
+ */
+@interface RLMDescriptionOptions : NSObject <NSCopying>
+
+/**
+ The maximum depth of nested objects and collections to write, counting the
+ results collection itself as the first level as `description` does. Objects
+ nested more deeply are written as `<Maximum depth exceeded>`, or `null` when
+ writing JSON. Defaults to 5.
+ */
+@property (nonatomic) NSUInteger maxDepth;
+
+/**
+ The maximum number of objects from the results collection to write. Zero
+ means that all objects are written. Defaults to 0.
+ */
+@property (nonatomic) NSUInteger maxObjects;
+
+/**
+ The maximum number of values to write from each list, set, or dictionary
+ property. Zero means that all values are written. Defaults to 100, or to 0
+ when writing JSON so that the output can be read back in by the JSON importer.
+ Collections truncated in JSON output are written without any marker.
+ */
+@property (nonatomic) NSUInteger maxNestedObjects;
+
+/**
+ Whether to write newline-delimited JSON rather than the format used by
+ `description`. If `YES`, each object is written as a JSON object on its own
+ line, using the same representations of values as
+ `-[RLMRealm importObjectsOfClass:fromJSONStream:options:error:]`. Defaults
+ to `NO`.
+ */
+@property (nonatomic) BOOL json;
+
+@end
+
 RLM_HEADER_AUDIT_END(nullability, sendability)
@@ -21,6 +21,7 @@
 #import "RLMAccessor.hpp"
 #import "RLMArray_Private.hpp"
 #import "RLMCollection_Private.hpp"
+#import "RLMDescriptionWriter.hpp"
 #import "RLMObjectSchema_Private.hpp"
 #import "RLMObjectStore.h"
 #import "RLMObject_Private.hpp"
@@ -60,6 +61,35 @@ using namespace realm;
 @property (nonatomic, nullable) RLMObjectId *associatedSubscriptionId;
 @end
 
+@interface RLMResults ()
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                    count:(NSUInteger)len
+                           reuseAccessors:(bool)reuseAccessors;
+@end
+
+// The object returned from -[RLMResults objectsReusingAccessors], which just
+// forwards fast enumeration back to the Results with accessor reuse enabled
+@interface RLMAccessorReusingEnumeration : NSObject <NSFastEnumeration>
+@end
+
+@implementation RLMAccessorReusingEnumeration {
+    RLMResults *_results;
+}
+
+- (instancetype)initWithResults:(RLMResults *)results {
+    if (self = [super init]) {
+        _results = results;
+    }
+    return self;
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(__unused __unsafe_unretained id [])buffer
+                                    count:(NSUInteger)len {
+    return [_results countByEnumeratingWithState:state count:len reuseAccessors:true];
+}
+@end
+
 //
 // RLMResults implementation
 //
@@ -173,8 +203,8 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
 }
 
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
-                                  objects:(__unused __unsafe_unretained id [])buffer
-                                    count:(NSUInteger)len {
+                                    count:(NSUInteger)len
+                           reuseAccessors:(bool)reuseAccessors {
     if (!_info) {
         return 0;
     }
@@ -183,7 +213,17 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
             _results.evaluate_query_if_needed();
         });
     }
-    return RLMFastEnumerate(state, len, self);
+    return RLMFastEnumerate(state, len, self, reuseAccessors);
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state
+                                  objects:(__unused __unsafe_unretained id [])buffer
+                                    count:(NSUInteger)len {
+    return [self countByEnumeratingWithState:state count:len reuseAccessors:false];
+}
+
+- (id<NSFastEnumeration>)objectsReusingAccessors {
+    return [[RLMAccessorReusingEnumeration alloc] initWithResults:self];
 }
 
 - (NSUInteger)indexOfObjectWhere:(NSString *)predicateFormat, ... {
@@ -208,7 +248,7 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
         if (_results.get_type() != realm::PropertyType::Object) {
             @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
         }
-        return RLMConvertNotFound(_results.index_of(RLMPredicateToQuery(predicate, _info->rlmObjectSchema, _realm.schema, _realm.group)));
+        return RLMConvertNotFound(_results.index_of(RLMPredicateToQuery(predicate, *_info)));
     });
 }
 
@@ -388,7 +428,7 @@ static inline void RLMResultsValidateInWriteTransaction(__unsafe_unretained RLMR
         if (_results.get_type() != realm::PropertyType::Object) {
             @throw RLMException(@"Querying is currently only implemented for arrays of Realm Objects");
         }
-        auto query = RLMPredicateToQuery(predicate, _info->rlmObjectSchema, _realm.schema, _realm.group);
+        auto query = RLMPredicateToQuery(predicate, *_info);
         return [self subresultsWithResults:_results.filter(std::move(query))];
     });
 }
@@ -448,6 +488,207 @@ returnNilForEmpty:(BOOL)returnNilForEmpty {
     return value ? RLMMixedToObjc(*value) : nil;
 }
 
+// Read the value of a single property for each of the objects in the given
+// range directly from the table, without creating accessor objects
+template<typename T, typename Fn>
+static void readColumn(__unsafe_unretained RLMResults *const ar, NSString *propertyName,
+                       RLMPropertyType type, NSRange range, T *buffer, Fn&& fn) {
+    if (!ar->_info || ar->_results.get_mode() == Results::Mode::Empty) {
+        if (range.location + range.length > 0) {
+            @throw RLMException(@"Range %@ is out of bounds (must be within 0 to 0).",
+                                NSStringFromRange(range));
+        }
+        return;
+    }
+    if (ar.type != RLMPropertyTypeObject) {
+        @throw RLMException(@"Cannot read property '%@' from RLMResults<%@>: only RLMResults of objects can be read by column.",
+                            propertyName, RLMTypeToString(ar.type));
+    }
+    RLMProperty *prop = RLMValidatedProperty(ar->_info->rlmObjectSchema, propertyName);
+    if (prop.type != type || prop.collection) {
+        @throw RLMException(@"Property '%@' on '%@' is of type '%@' and cannot be read as '%@'.",
+                            propertyName, ar->_info->rlmObjectSchema.className,
+                            RLMTypeToString(prop.type), RLMTypeToString(type));
+    }
+    ColKey column = ar->_info->tableColumn(prop);
+
+    size_t count = translateErrors([&] { return ar->_results.size(); });
+    if (range.location > count || range.length > count - range.location) {
+        @throw RLMException(@"Range %@ is out of bounds (must be within 0 to %zu).",
+                            NSStringFromRange(range), count);
+    }
+    translateErrors([&] {
+        for (NSUInteger i = 0; i < range.length; ++i) {
+            buffer[i] = fn(ar->_results.get(range.location + i), column);
+        }
+    });
+}
+
+template<typename T>
+static std::optional<T> getOptional(Obj const& obj, ColKey column) {
+    if (column.is_nullable()) {
+        return obj.get<std::optional<T>>(column);
+    }
+    return obj.get<T>(column);
+}
+
+- (void)readInt64Column:(NSString *)property into:(int64_t *)buffer range:(NSRange)range {
+    readColumn(self, property, RLMPropertyTypeInt, range, buffer, [](Obj const& obj, ColKey col) {
+        return getOptional<Int>(obj, col).value_or(0);
+    });
+}
+
+- (void)readDoubleColumn:(NSString *)property into:(double *)buffer range:(NSRange)range {
+    readColumn(self, property, RLMPropertyTypeDouble, range, buffer, [](Obj const& obj, ColKey col) {
+        return getOptional<double>(obj, col).value_or(NAN);
+    });
+}
+
+- (void)readFloatColumn:(NSString *)property into:(float *)buffer range:(NSRange)range {
+    readColumn(self, property, RLMPropertyTypeFloat, range, buffer, [](Obj const& obj, ColKey col) {
+        return getOptional<float>(obj, col).value_or(NAN);
+    });
+}
+
+- (void)readBoolColumn:(NSString *)property into:(bool *)buffer range:(NSRange)range {
+    readColumn(self, property, RLMPropertyTypeBool, range, buffer, [](Obj const& obj, ColKey col) {
+        return getOptional<bool>(obj, col).value_or(false);
+    });
+}
+
+- (void)readTimestampColumn:(NSString *)property into:(NSTimeInterval *)buffer range:(NSRange)range {
+    readColumn(self, property, RLMPropertyTypeDate, range, buffer, [](Obj const& obj, ColKey col) {
+        auto ts = obj.get<Timestamp>(col);
+        if (ts.is_null()) {
+            return (NSTimeInterval)NAN;
+        }
+        // Matches the conversion in RLMTimestampToNSDate()
+        return ts.get_seconds() - NSTimeIntervalSince1970 + ts.get_nanoseconds() / 1'000'000'000.0;
+    });
+}
+
+- (void)readStringColumn:(NSString *)property
+                    into:(NSString *__strong *)buffer
+                   range:(NSRange)range {
+    readColumn(self, property, RLMPropertyTypeString, range, buffer, [](Obj const& obj, ColKey col) {
+        return RLMStringDataToNSString(obj.get<StringData>(col));
+    });
+}
+
+// Running totals for a single property in aggregateProperties:into:. Values
+// are gathered into a contiguous buffer a block of rows at a time, with a
+// parallel buffer of null flags, so that the reduction is a simple loop over
+// doubles which the compiler can vectorize. Null values are stored as NaN so
+// that fmin and fmax skip them, but a stored NaN is still a value and is
+// counted and included in the sum.
+struct AggregateAccumulator {
+    ColKey column;
+    RLMPropertyType type;
+    size_t count = 0;
+    double min = NAN;
+    double max = NAN;
+    double sum = 0;
+
+    double read(Obj const& obj, bool& isNull) const {
+        Mixed value = obj.get_any(column);
+        isNull = value.is_null();
+        if (isNull) {
+            return NAN;
+        }
+        switch (type) {
+            case RLMPropertyTypeInt:
+                return static_cast<double>(value.get_int());
+            case RLMPropertyTypeFloat:
+                return value.get_float();
+            default:
+                return value.get_double();
+        }
+    }
+
+    void reduce(const double *values, const bool *nulls, size_t size) {
+        size_t blockCount = 0;
+        double blockSum = 0;
+        double blockMin = min, blockMax = max;
+        for (size_t i = 0; i < size; ++i) {
+            double value = values[i];
+            bool isNull = nulls[i];
+            blockCount += !isNull;
+            blockSum += isNull ? 0.0 : value;
+            // fmin and fmax return the other argument when one is NaN
+            blockMin = std::fmin(blockMin, value);
+            blockMax = std::fmax(blockMax, value);
+        }
+        count += blockCount;
+        sum += blockSum;
+        min = blockMin;
+        max = blockMax;
+    }
+};
+
+- (void)aggregateProperties:(NSArray<NSString *> *)properties into:(RLMAggregateResult *)results {
+    if (self.type != RLMPropertyTypeObject) {
+        @throw RLMException(@"Cannot aggregate properties of RLMResults<%@>: only RLMResults of objects can be aggregated by property.",
+                            RLMTypeToString(self.type));
+    }
+
+    if (!_info) {
+        // Detached results (such as linking objects on an unmanaged object)
+        // have no schema to validate against, but are always empty
+        for (NSUInteger i = 0; i < properties.count; ++i) {
+            results[i] = {.count = 0, .min = NAN, .max = NAN, .sum = 0, .average = NAN};
+        }
+        return;
+    }
+
+    std::vector<AggregateAccumulator> accumulators;
+    accumulators.reserve(properties.count);
+    for (NSString *name in properties) {
+        RLMProperty *prop = RLMValidatedProperty(_info->rlmObjectSchema, name);
+        if (prop.collection || (prop.type != RLMPropertyTypeInt && prop.type != RLMPropertyTypeFloat
+                                && prop.type != RLMPropertyTypeDouble)) {
+            @throw RLMException(@"Property '%@' on '%@' is of type '%@' and cannot be aggregated: only int, float and double properties are supported.",
+                                name, _info->rlmObjectSchema.className, RLMTypeToString(prop.type));
+        }
+        accumulators.push_back({_info->tableColumn(prop), prop.type});
+    }
+
+    if (_results.get_mode() != Results::Mode::Empty && !accumulators.empty()) {
+        translateErrors([&] {
+            // Read every property from each object while it is at hand rather
+            // than making a separate pass over the view for each aggregate
+            TableView tv = _results.get_tableview();
+            constexpr size_t blockSize = 1024;
+            std::vector<double> buffer(blockSize * accumulators.size());
+            auto nulls = std::make_unique<bool[]>(blockSize * accumulators.size());
+            size_t size = tv.size();
+            for (size_t start = 0; start < size; start += blockSize) {
+                size_t blockLength = std::min(blockSize, size - start);
+                for (size_t i = 0; i < blockLength; ++i) {
+                    Obj obj = tv.get_object(start + i);
+                    for (size_t j = 0; j < accumulators.size(); ++j) {
+                        size_t index = j * blockSize + i;
+                        buffer[index] = accumulators[j].read(obj, nulls[index]);
+                    }
+                }
+                for (size_t j = 0; j < accumulators.size(); ++j) {
+                    accumulators[j].reduce(&buffer[j * blockSize], &nulls[j * blockSize], blockLength);
+                }
+            }
+        });
+    }
+
+    for (size_t i = 0; i < accumulators.size(); ++i) {
+        auto& acc = accumulators[i];
+        results[i] = {
+            .count = acc.count,
+            .min = acc.min,
+            .max = acc.max,
+            .sum = acc.sum,
+            .average = acc.count ? acc.sum / acc.count : NAN,
+        };
+    }
+}
+
 - (id)minOfProperty:(NSString *)property {
     return [self aggregate:property method:&Results::min returnNilForEmpty:YES];
 }
@@ -498,6 +739,22 @@ returnNilForEmpty:(BOOL)returnNilForEmpty {
     return RLMDescriptionWithMaxDepth(@"RLMResults", self, RLMDescriptionMaxDepth);
 }
 
+- (BOOL)writeDescriptionToFileDescriptor:(int)fileDescriptor
+                                 options:(RLMDescriptionOptions *)options
+                                   error:(NSError **)error {
+    return translateErrors([&] {
+        return RLMWriteResultsDescription(self, fileDescriptor, options, error);
+    });
+}
+
+- (void)writeDescriptionToLogger:(RLMLogger *)logger
+                           level:(RLMLogLevel)level
+                         options:(RLMDescriptionOptions *)options {
+    translateErrors([&] {
+        RLMLogResultsDescription(self, logger, level, options);
+    });
+}
+
 - (realm::TableView)tableView {
     return translateErrors([&] { return _results.get_tableview(); });
 }
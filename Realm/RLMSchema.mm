@@ -33,6 +33,7 @@
 #import <realm/object-store/schema.hpp>
 #import <realm/util/scope_exit.hpp>
 
+#import <atomic>
 #import <mutex>
 #import <objc/runtime.h>
 
@@ -71,6 +72,10 @@ static enum class SharedSchemaState {
 @implementation RLMSchema {
     NSArray *_objectSchema;
     realm::Schema _objectStoreSchema;
+    // Classes which have been discovered for the shared schema but not yet
+    // reflected. Guarded by s_localNameToClass.
+    NSMutableDictionary<NSString *, Class> *_pendingClasses;
+    std::atomic<bool> _hasPendingClasses;
 }
 
 static void createAccessors(RLMObjectSchema *objectSchema) {
@@ -85,8 +90,12 @@ static void createAccessors(RLMObjectSchema *objectSchema) {
     static unsigned long long count = 0;
     snprintf(start, bufferSize - strlen(className),
              "%llu %s", count++, objectSchema.className.UTF8String);
-    objectSchema.accessorClass = RLMManagedAccessorClassForObjectClass(objectSchema.objectClass, objectSchema, className);
     objectSchema.unmanagedClass = RLMUnmanagedAccessorClassForObjectClass(objectSchema.objectClass, objectSchema);
+    // RLMSchemaEnsureAccessorsCreated() checks accessorClass without holding
+    // the lock, so it has to be published last
+    Class accessorClass = RLMManagedAccessorClassForObjectClass(objectSchema.objectClass, objectSchema, className);
+    std::atomic_thread_fence(std::memory_order_release);
+    objectSchema.accessorClass = accessorClass;
 }
 
 void RLMSchemaEnsureAccessorsCreated(RLMSchema *schema) {
@@ -96,7 +105,11 @@ void RLMSchemaEnsureAccessorsCreated(RLMSchema *schema) {
             // the expense of worse perf in the rare scenario where this is
             // actually needed.
             @synchronized(s_localNameToClass) {
-                createAccessors(objectSchema);
+                // Another thread opening a different Realm file with the same
+                // schema may have created them while we were waiting
+                if (objectSchema.accessorClass == objectSchema.objectClass) {
+                    createAccessors(objectSchema);
+                }
             }
         }
     }
@@ -130,6 +143,37 @@ static RLMObjectSchema *registerClass(Class cls) {
     return schema;
 }
 
+// Caller must @synchronize on s_localNameToClass
+static RLMObjectSchema *reflectPendingClass(RLMSchema *schema, NSString *className) {
+    Class cls = schema->_pendingClasses[className];
+    if (!cls) {
+        return nil;
+    }
+
+    // The class is only removed from the pending set once it has been
+    // reflected successfully, so an invalid class throws on every use
+    RLMObjectSchema *objectSchema = registerClass(cls);
+    schema->_objectSchemaByName[className] = objectSchema;
+    schema->_objectSchema = nil;
+    [schema->_pendingClasses removeObjectForKey:className];
+    if (schema->_pendingClasses.count == 0) {
+        schema->_pendingClasses = nil;
+        schema->_hasPendingClasses.store(false, std::memory_order_release);
+    }
+    return objectSchema;
+}
+
+static void reflectAllPendingClasses(RLMSchema *schema) {
+    if (!schema->_hasPendingClasses.load(std::memory_order_acquire)) {
+        return;
+    }
+    @synchronized(s_localNameToClass) {
+        for (NSString *className in schema->_pendingClasses.allKeys) {
+            reflectPendingClass(schema, className);
+        }
+    }
+}
+
 // Caller must @synchronize on s_localNameToClass
 static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
     for (NSUInteger i = 0; i < count; i++) {
@@ -178,6 +222,7 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
 }
 
 - (NSArray *)objectSchema {
+    reflectAllPendingClasses(self);
     if (!_objectSchema) {
         _objectSchema = [_objectSchemaByName allValues];
     }
@@ -193,6 +238,20 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
 }
 
 - (RLMObjectSchema *)schemaForClassName:(NSString *)className {
+    if (_hasPendingClasses.load(std::memory_order_acquire)) {
+        // Other classes may be being reflected concurrently, so the lookup
+        // has to be done while holding the lock
+        @synchronized(s_localNameToClass) {
+            if (RLMObjectSchema *schema = reflectPendingClass(self, className) ?: _objectSchemaByName[className]) {
+                return schema;
+            }
+            // Classes discovered after the schema was initialized are
+            // registered but never added to it
+            [[RLMSchema classForString:className] sharedSchema];
+            return nil;
+        }
+    }
+
     if (RLMObjectSchema *schema = _objectSchemaByName[className]) {
         return schema; // fast path for already-initialized schemas
     } else if (Class cls = [RLMSchema classForString:className]) {
@@ -300,16 +359,27 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
                 malloc_ptr classes(objc_copyClassList(&numClasses), &free);
                 RLMRegisterClassLocalNames(classes.get(), numClasses);
             }
-
-            [s_localNameToClass enumerateKeysAndObjectsUsingBlock:^(NSString *, Class cls, BOOL *) {
-                registerClass(cls);
-            }];
         }
         catch (...) {
             s_sharedSchemaState = SharedSchemaState::Uninitialized;
             throw;
         }
 
+        // Reflecting every class up front is slow for apps with many model
+        // classes, so each class is instead reflected and validated the
+        // first time it's looked up or the full schema is needed
+        NSMutableDictionary<NSString *, Class> *pending = [NSMutableDictionary new];
+        [s_localNameToClass enumerateKeysAndObjectsUsingBlock:^(NSString *className, Class cls, BOOL *) {
+            if (!s_sharedSchema->_objectSchemaByName[className] && [cls shouldIncludeInDefaultSchema]) {
+                pending[className] = cls;
+            }
+        }];
+        if (pending.count) {
+            s_sharedSchema->_pendingClasses = pending;
+            s_sharedSchema->_objectSchema = nil;
+            s_sharedSchema->_hasPendingClasses.store(true, std::memory_order_release);
+        }
+
         // Replace this method with one that doesn't need to acquire a lock
         Class metaClass = objc_getMetaClass(class_getName(self));
         IMP imp = imp_implementationWithBlock(^{ return s_sharedSchema; });
@@ -357,6 +427,7 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
 }
 
 - (id)copyWithZone:(NSZone *)zone {
+    reflectAllPendingClasses(self);
     RLMSchema *schema = [[RLMSchema allocWithZone:zone] init];
     schema->_objectSchemaByName = [[NSMutableDictionary allocWithZone:zone]
                                    initWithDictionary:_objectSchemaByName copyItems:YES];
@@ -364,6 +435,8 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
 }
 
 - (BOOL)isEqualToSchema:(RLMSchema *)schema {
+    reflectAllPendingClasses(self);
+    reflectAllPendingClasses(schema);
     if (_objectSchemaByName.count != schema->_objectSchemaByName.count) {
         return NO;
     }
@@ -387,7 +460,17 @@ static void RLMRegisterClassLocalNames(Class *classes, NSUInteger count) {
     return [NSString stringWithFormat:@"Schema {\n%@}", objectSchemaString];
 }
 
+// The object store schema is computed lazily and cached. Schemas such as the
+// shared schema are used by concurrent opens of different files, so the cache
+// is guarded by the schema's lock.
 - (Schema)objectStoreCopy {
+    reflectAllPendingClasses(self);
+    @synchronized(self) {
+        return [self objectStoreSchema];
+    }
+}
+
+- (Schema const&)objectStoreSchema {
     if (_objectStoreSchema.size() == 0) {
         std::vector<realm::ObjectSchema> schema;
         schema.reserve(_objectSchemaByName.count);
@@ -66,22 +66,37 @@ private:
 
 };
 
+// The property is resolved to its column once when the storage is created,
+// and reads go directly through the Obj rather than looking the property up by
+// name in the ObjectSchema on each access.
 class ManagedSwiftValueStorage : public SwiftValueStorageBase {
 public:
     ManagedSwiftValueStorage(RLMObjectBase *obj, RLMProperty *prop)
     : _realm(obj->_realm)
-    , _object(obj->_realm->_realm, *obj->_info->objectSchema, obj->_row)
-    , _columnName(prop.columnName.UTF8String)
-    , _ctx(obj, &obj->_info->objectSchema->persisted_properties[prop.index])
+    , _info(obj->_info)
+    , _obj(obj->_row)
+    , _property(obj->_info->objectSchema->persisted_properties[prop.index])
+    , _ctx(obj, &_property)
     {
+        _ctx.currentProperty = prop;
     }
 
     id get() override {
-        return _object.get_property_value<id>(_ctx, _columnName);
+        if (!_obj.is_valid()) {
+            @throw RLMException(@"Accessing object of type %s which has been invalidated or deleted",
+                                _info->objectSchema->name.c_str());
+        }
+        [_realm verifyThread];
+        // AnyRealmValue properties are Mixed columns, and the optional
+        // primitives used by RealmProperty are all representable as Mixed
+        return _ctx.box(_obj.get_any(_property.column_key));
     }
 
     void set(__unsafe_unretained id const value) override {
-        _object.set_property_value(_ctx, _columnName, value ?: NSNull.null);
+        // Writes go through realm::Object for validation and KVO, but with the
+        // already-resolved property
+        realm::Object object(_realm->_realm, *_info->objectSchema, _obj);
+        object.set_property_value(_ctx, _property, value ?: NSNull.null);
     }
 
     NSString *propertyName() override {
@@ -92,9 +107,10 @@ public:
 private:
     // We have to hold onto a strong reference to the Realm as
     // RLMAccessorContext holds a non-retaining one.
-    __unused RLMRealm *_realm;
-    realm::Object _object;
-    std::string _columnName;
+    RLMRealm *_realm;
+    RLMClassInfo *_info;
+    realm::Obj _obj;
+    realm::Property const& _property;
     RLMAccessorContext _ctx;
 };
 } // anonymous namespace
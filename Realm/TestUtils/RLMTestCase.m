@@ -103,7 +103,7 @@ static BOOL encryptTests(void) {
 // allowing hundreds of test cases to fail in strange ways
 // This is overridden by RLMMultiProcessTestCase to support testing the schema init
 + (void)preinitializeSchema {
-    [RLMSchema sharedSchema];
+    [RLMSchema.sharedSchema objectSchema];
 }
 
 // A hook point for subclasses to override the cleanup
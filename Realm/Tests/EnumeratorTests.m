@@ -76,4 +76,40 @@
     }
 }
 
+- (void)testEnumerateReusingAccessors
+{
+    RLMRealm *realm = [RLMRealm defaultRealm];
+
+    for (EmployeeObject *row in [[EmployeeObject allObjects] objectsReusingAccessors]) {
+        XCTFail(@"No objects should have been added %@", row);
+    }
+
+    // Enough objects to need several batches, with the last one partially full
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 1000; ++i) {
+        [EmployeeObject createInRealm:realm withValue:@{@"name": @"name", @"age": @(i), @"hired": @(i % 2)}];
+    }
+    [realm commitWriteTransaction];
+
+    int index = 0;
+    for (EmployeeObject *row in [[EmployeeObject allObjects] objectsReusingAccessors]) {
+        XCTAssertEqual(row.age, index);
+        XCTAssertEqual(row.hired, (BOOL)(index % 2));
+        index++;
+    }
+    XCTAssertEqual(index, 1000);
+
+    // Enumerating inside a write transaction enumerates a snapshot
+    index = 0;
+    [realm beginWriteTransaction];
+    RLMResults *hired = [EmployeeObject objectsWhere:@"hired = YES"];
+    for (EmployeeObject *row in [hired objectsReusingAccessors]) {
+        XCTAssertEqual(row.age, index * 2 + 1);
+        row.hired = NO;
+        index++;
+    }
+    [realm cancelWriteTransaction];
+    XCTAssertEqual(index, 500);
+}
+
 @end
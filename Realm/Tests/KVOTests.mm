@@ -1902,6 +1902,30 @@ public:
     XCTAssertTrue(r3.empty());
 }
 
+- (void)testObserveNewObjectReusingKeyOfDeletedObject {
+    IntObject *deleted = [IntObject createInRealm:_realm withValue:@[@1]];
+    realm::ObjKey key = deleted->_row.get_key();
+    KVORecorder r1(self, deleted, @"intCol");
+    KVORecorder r2(self, deleted, RLMInvalidatedKey);
+    [self.realm deleteObject:deleted];
+    AssertChanged(r2, @NO, @YES);
+
+    // Create a new object with the same key while the deleted object is
+    // still observed
+    RLMClassInfo& info = _realm->_info[@"IntObject"];
+    info.table()->create_object(key);
+    IntObject *obj = (IntObject *)RLMCreateObjectAccessor(info, key.value);
+    KVORecorder r3(self, obj, @"intCol");
+
+    // Modifying the row through another accessor notifies only the observers
+    // of the new object
+    IntObject *other = (IntObject *)RLMCreateObjectAccessor(info, key.value);
+    other.intCol = 5;
+    AssertChanged(r3, @0, @5);
+    XCTAssertTrue(r1.empty());
+    XCTAssertTrue(r2.empty());
+}
+
 - (void)testDeleteMiddleOfKeyPath {
     KVOLinkObject2 *obj = [self createLinkObject];
     KVORecorder r(self, obj, @"obj.obj.boolCol");
@@ -2022,6 +2046,23 @@ public:
     AssertIndexChange(NSKeyValueChangeRemoval, [NSIndexSet indexSetWithIndex:0]);
 }
 
+- (void)testDeleteObjectAtNonContiguousIndexesInArray {
+    KVOLinkObject2 *obj = [self createLinkObject];
+    KVOLinkObject2 *obj2 = [self createLinkObject];
+    KVOLinkObject1 *linked = obj.obj;
+    [obj.array addObject:linked];
+    [obj.array addObject:obj2.obj];
+    [obj.array addObject:linked];
+    [obj.array addObject:linked];
+    [obj.array addObject:obj2.obj];
+
+    KVORecorder r(self, obj, @"array");
+    [self.realm deleteObject:linked];
+    NSMutableIndexSet *expected = [NSMutableIndexSet indexSetWithIndex:0];
+    [expected addIndexesInRange:{2, 2}];
+    AssertIndexChange(NSKeyValueChangeRemoval, expected);
+}
+
 - (void)testDeleteObjectsInArrayViaTableClear {
     KVOLinkObject2 *obj = [self createLinkObject];
     KVOLinkObject2 *obj2 = [self createLinkObject];
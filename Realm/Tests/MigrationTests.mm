@@ -867,6 +867,222 @@ RLM_COLLECTION_TYPE(MigrationTestObject);
     XCTAssertEqualObjects(mig1[@"stringCol"], @"2", @"stringCol should be string after migration.");
 }
 
+- (void)testCopyValuesOfPropertyConvertsType {
+    // make string an int
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    RLMProperty *stringCol = objectSchema.properties[1];
+    stringCol.type = RLMPropertyTypeInt;
+    stringCol.optional = NO;
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        for (int i = 0; i < 100; ++i) {
+            [realm createObject:MigrationTestObject.className withValue:@[@(i), @(i * 10)]];
+        }
+    }];
+
+    RLMRealm *realm = [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        [migration copyValuesOfProperty:@"stringCol" toProperty:@"stringCol" ofClass:MigrationTestObject.className];
+    }];
+
+    RLMResults *objects = [MigrationTestObject allObjectsInRealm:realm];
+    XCTAssertEqual(objects.count, 100U);
+    for (MigrationTestObject *obj in objects) {
+        XCTAssertEqualObjects(obj.stringCol, ([NSString stringWithFormat:@"%d", obj.intCol * 10]));
+    }
+}
+
+- (void)testCopyValuesOfPropertySkipsObjectsCreatedDuringMigration {
+    // make string an int
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    RLMProperty *stringCol = objectSchema.properties[1];
+    stringCol.type = RLMPropertyTypeInt;
+    stringCol.optional = NO;
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        for (int i = 1; i <= 3; ++i) {
+            [realm createObject:MigrationTestObject.className withValue:@[@(i), @(i * 10)]];
+        }
+    }];
+
+    RLMRealm *realm = [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        NSString *className = MigrationTestObject.className;
+        // The new object may be given the key of the deleted one, but must
+        // not be given the deleted object's old value
+        __block RLMObject *last;
+        [migration enumerateObjects:className block:^(RLMObject *oldObject, RLMObject *newObject) {
+            if ([oldObject[@"intCol"] intValue] == 3) {
+                last = newObject;
+            }
+        }];
+        [migration deleteObject:last];
+        [migration createObject:className withValue:@[@-1, @"created"]];
+        [migration createObject:className withValue:@[@-2, @"created"]];
+        [migration copyValuesOfProperty:@"stringCol" toProperty:@"stringCol" ofClass:className];
+    }];
+
+    RLMResults *objects = [[MigrationTestObject allObjectsInRealm:realm] sortedResultsUsingKeyPath:@"intCol" ascending:YES];
+    XCTAssertEqual(objects.count, 4U);
+    XCTAssertEqualObjects([objects[0] stringCol], @"created");
+    XCTAssertEqualObjects([objects[1] stringCol], @"created");
+    XCTAssertEqualObjects([objects[2] stringCol], @"10");
+    XCTAssertEqualObjects([objects[3] stringCol], @"20");
+}
+
+- (void)testCopyValuesOfPropertyErrors {
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        [realm createObject:MigrationTestObject.className withValue:@[@1, @"not a number"]];
+    }];
+
+    // Copy the string column to the int column, which can't convert the value
+    [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        RLMAssertThrowsWithReason([migration copyValuesOfProperty:@"stringCol" toProperty:@"intCol"
+                                                          ofClass:MigrationTestObject.className],
+                                  @"Cannot convert value 'not a number' of property 'MigrationTestObject.stringCol' to 'int' for property 'intCol'.");
+        RLMAssertThrowsWithReason([migration copyValuesOfProperty:@"noSuchCol" toProperty:@"intCol"
+                                                          ofClass:MigrationTestObject.className],
+                                  @"Property 'noSuchCol' is not present on 'MigrationTestObject' in the old schema.");
+        RLMAssertThrowsWithReason([migration copyValuesOfProperty:@"intCol" toProperty:@"intCol"
+                                                          ofClass:@"NoSuchClass"],
+                                  @"Object type 'NoSuchClass' is not present in the old schema.");
+    }];
+}
+
+- (void)testTransformProperty {
+    // make string an int
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    RLMProperty *stringCol = objectSchema.properties[1];
+    stringCol.type = RLMPropertyTypeInt;
+    stringCol.optional = NO;
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        for (int i = 0; i < 10; ++i) {
+            [realm createObject:MigrationTestObject.className withValue:@[@(i), @(i * 10)]];
+        }
+    }];
+
+    RLMRealm *realm = [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        [migration transformProperty:@"stringCol" ofClass:MigrationTestObject.className
+                               using:^(id<RLMValue> oldValue) {
+            return [NSString stringWithFormat:@"#%@", oldValue];
+        }];
+        // Values returned from the block are converted to the property type
+        [migration transformProperty:@"intCol" ofClass:MigrationTestObject.className
+                               using:^(id<RLMValue> oldValue) {
+            return [(NSNumber *)oldValue stringValue];
+        }];
+    }];
+
+    for (MigrationTestObject *obj in [MigrationTestObject allObjectsInRealm:realm]) {
+        XCTAssertEqualObjects(obj.stringCol, ([NSString stringWithFormat:@"#%d", obj.intCol * 10]));
+    }
+}
+
+- (void)testTransformPropertyWithConverters {
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    RLMProperty *nameCol = [objectSchema.properties[1] copy];
+    nameCol.name = @"name";
+    nameCol.columnName = @"name";
+    objectSchema.properties = @[nameCol];
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        [realm createObject:MigrationTestObject.className withValue:@[@"12 Mary"]];
+        [realm createObject:MigrationTestObject.className withValue:@[@"34"]];
+        [realm createObject:MigrationTestObject.className withValue:@[@"56 Bob"]];
+    }];
+
+    RLMRealm *realm = [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        NSString *className = MigrationTestObject.className;
+        [migration transformProperty:@"name" ofClass:className toProperty:@"intCol"
+                       withConverter:[RLMPropertyConverter componentSeparatedByString:@" " atIndex:0]];
+        [migration transformProperty:@"name" ofClass:className toProperty:@"stringCol"
+                       withConverter:[RLMPropertyConverter componentSeparatedByString:@" " atIndex:1]];
+        RLMAssertThrowsWithReason([migration transformProperty:@"name" ofClass:className toProperty:@"intCol"
+                                                 withConverter:RLMPropertyConverter.typeConversion],
+                                  @"Cannot convert value '12 Mary' of property 'MigrationTestObject.name' to 'int' for property 'intCol'.");
+        [migration transformProperty:@"noSuchCol" ofClass:className toProperty:@"stringCol"
+                       withConverter:[RLMPropertyConverter typeConversionWithDefault:@"default"]];
+    }];
+
+    RLMResults *objects = [[MigrationTestObject allObjectsInRealm:realm] sortedResultsUsingKeyPath:@"intCol" ascending:YES];
+    XCTAssertEqual(objects.count, 3U);
+    XCTAssertEqual([objects[0] intCol], 12);
+    XCTAssertEqual([objects[1] intCol], 34);
+    XCTAssertEqual([objects[2] intCol], 56);
+    for (MigrationTestObject *obj in objects) {
+        XCTAssertEqualObjects(obj.stringCol, @"default");
+    }
+}
+
+- (void)testTransformObjects {
+    // make string an int
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:MigrationTestObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    RLMProperty *stringCol = objectSchema.properties[1];
+    stringCol.type = RLMPropertyTypeInt;
+    stringCol.optional = NO;
+
+    [self createTestRealmWithSchema:@[objectSchema] block:^(RLMRealm *realm) {
+        for (int i = 0; i < 1000; ++i) {
+            [realm createObject:MigrationTestObject.className withValue:@[@(i), @(i * 2)]];
+        }
+    }];
+
+    RLMRealm *realm = [self migrateTestRealmWithBlock:^(RLMMigration *migration, uint64_t) {
+        // Objects deleted earlier in the migration are skipped
+        [migration enumerateObjects:MigrationTestObject.className block:^(RLMObject *oldObject, RLMObject *newObject) {
+            if ([oldObject[@"intCol"] intValue] % 3 == 0) {
+                [migration deleteObject:newObject];
+            }
+        }];
+
+        [migration transformObjects:MigrationTestObject.className batchSize:128 block:^(NSDictionary *oldValues) {
+            NSNumber *intObj = oldValues[@"stringCol"];
+            if (intObj.intValue % 5 == 0) {
+                return (NSDictionary *)nil;
+            }
+            return @{@"stringCol": intObj.stringValue};
+        }];
+    }];
+
+    RLMResults *objects = [MigrationTestObject allObjectsInRealm:realm];
+    XCTAssertEqual(objects.count, 666U);
+    for (MigrationTestObject *obj in objects) {
+        XCTAssertNotEqual(obj.intCol % 3, 0);
+        // Objects for which the block returned nil are left unchanged
+        if (obj.intCol * 2 % 5 == 0) {
+            XCTAssertNil(obj.stringCol);
+        }
+        else {
+            XCTAssertEqualObjects(obj.stringCol, ([NSString stringWithFormat:@"%d", obj.intCol * 2]));
+        }
+    }
+
+    // Errors thrown from the block are rethrown from the migration
+    RLMRealmConfiguration *config = self.config;
+    config.schemaVersion = 2;
+    config.migrationBlock = ^(RLMMigration *migration, uint64_t) {
+        RLMAssertThrowsWithReason([migration transformObjects:MigrationTestObject.className batchSize:0
+                                                        block:^NSDictionary *(NSDictionary *) {
+            return nil;
+        }], @"Batch size must be greater than zero.");
+        RLMAssertThrowsWithReason([migration transformObjects:MigrationTestObject.className batchSize:10000
+                                                        block:^NSDictionary *(NSDictionary *) {
+            @throw RLMException(@"transform error");
+        }], @"transform error");
+        RLMAssertThrowsWithReason([migration transformObjects:MigrationTestObject.className batchSize:10000
+                                                        block:^NSDictionary *(NSDictionary *) {
+            return @{@"noSuchCol": @1};
+        }], @"Invalid property name 'noSuchCol' for class 'MigrationTestObject'.");
+    };
+    XCTAssertTrue([RLMRealm performMigrationForConfiguration:config error:nil]);
+}
+
 - (void)testChangeObjectLinkType {
     // create realm with old schema and populate
     [self createTestRealmWithSchema:RLMSchema.sharedSchema.objectSchema block:^(RLMRealm *realm) {
@@ -1726,6 +1726,121 @@ static void ExpectChange(id self, NSArray *deletions, NSArray *insertions,
     [token invalidate];
 }
 
+- (void)testKeyPathFilter {
+    RLMKeyPathFilter *filter = [RLMKeyPathFilter filterWithKeyPaths:@[@"boolCol", @"stringCol"]];
+    XCTAssertEqualObjects(filter, (@[@"boolCol", @"stringCol"]));
+    XCTAssertEqual(filter, [filter copy]);
+
+    // Register the same filter repeatedly so that later registrations use the
+    // cached resolved key paths
+    XCTestExpectation *ex = [self expectationWithDescription:@"change notification"];
+    ex.expectedFulfillmentCount = 3;
+    NSMutableArray *tokens = [NSMutableArray new];
+    for (int i = 0; i < 3; ++i) {
+        [tokens addObject:[_obj addNotificationBlock:^(BOOL deleted, NSArray *changes, NSError *error) {
+            XCTAssertFalse(deleted);
+            XCTAssertNil(error);
+            XCTAssertEqual(changes.count, 1U);
+            XCTAssertEqualObjects([changes[0] name], @"boolCol");
+            [ex fulfill];
+        } keyPaths:filter]];
+    }
+
+    [_obj.realm beginWriteTransaction];
+    _obj.intCol = _obj.intCol + 1;
+    [_obj.realm commitWriteTransaction];
+    [_obj.realm beginWriteTransaction];
+    _obj.boolCol = !_obj.boolCol;
+    [_obj.realm commitWriteTransaction];
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    [tokens makeObjectsPerformSelector:@selector(invalidate)];
+
+    // Filters are resolved against the type they're used with
+    RLMAssertThrowsWithReason([_obj addNotificationBlock:^(__unused BOOL deleted,
+                                                           __unused NSArray *changes,
+                                                           __unused NSError *error) {}
+                                                keyPaths:[RLMKeyPathFilter filterWithKeyPaths:@[@"dogName"]]],
+                              @"property 'dogName' not found in object of type 'AllTypesObject'");
+}
+
+- (void)testAddNotificationBlockToObjects {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    [realm beginWriteTransaction];
+    NSArray *objects = @[[IntObject createInRealm:realm withValue:@[@0]],
+                         [IntObject createInRealm:realm withValue:@[@1]],
+                         [IntObject createInRealm:realm withValue:@[@2]]];
+    [realm commitWriteTransaction];
+
+    XCTestExpectation *modified = [self expectationWithDescription:@"modified"];
+    XCTestExpectation *deleted = [self expectationWithDescription:@"deleted"];
+    NSArray *tokens = [IntObject addNotificationBlock:^(NSUInteger index, BOOL isDeleted,
+                                                        NSArray<RLMPropertyChange *> *changes, NSError *error) {
+        XCTAssertNil(error);
+        if (isDeleted) {
+            XCTAssertEqual(index, 2U);
+            [deleted fulfill];
+        }
+        else {
+            XCTAssertEqual(index, 0U);
+            XCTAssertEqualObjects(changes[0].name, @"intCol");
+            XCTAssertEqualObjects(changes[0].value, @10);
+            [modified fulfill];
+        }
+    } toObjects:objects keyPaths:nil queue:self.bgQueue];
+    XCTAssertEqual(tokens.count, 3U);
+    // Wait for the registration to happen on the queue
+    dispatch_sync(self.bgQueue, ^{});
+
+    // Changes to the object whose token was invalidated are not reported
+    [tokens[1] invalidate];
+    [realm transactionWithBlock:^{
+        [objects[0] setIntCol:10];
+        [objects[1] setIntCol:11];
+        [realm deleteObject:objects[2]];
+    }];
+    [self waitForExpectationsWithTimeout:2.0 handler:nil];
+    [tokens makeObjectsPerformSelector:@selector(invalidate)];
+
+    RLMObjectsChangeBlock noop = ^(__unused NSUInteger index, __unused BOOL isDeleted,
+                                   __unused NSArray *changes, __unused NSError *error) {};
+    XCTAssertEqualObjects([IntObject addNotificationBlock:noop toObjects:@[] keyPaths:nil queue:self.bgQueue], @[]);
+    RLMAssertThrowsWithReason([IntObject addNotificationBlock:noop toObjects:@[[IntObject new]]
+                                                     keyPaths:nil queue:self.bgQueue],
+                              @"Only objects which are managed by a Realm support change notifications");
+    [realm beginWriteTransaction];
+    RLMAssertThrowsWithReason([IntObject addNotificationBlock:noop toObjects:@[objects[0]]
+                                                     keyPaths:nil queue:self.bgQueue],
+                              @"Cannot register notification blocks from within write transactions.");
+    [realm cancelWriteTransaction];
+}
+
+- (void)testInvalidateTokensForObjectsBeforeRegistration {
+    RLMRealm *realm = RLMRealm.defaultRealm;
+    [realm beginWriteTransaction];
+    NSArray *objects = @[[IntObject createInRealm:realm withValue:@[@0]],
+                         [IntObject createInRealm:realm withValue:@[@1]]];
+    [realm commitWriteTransaction];
+
+    // Hold off registration until after the tokens are invalidated, with one
+    // of the objects deleted in the meantime
+    dispatch_suspend(self.bgQueue);
+    NSArray *tokens = [IntObject addNotificationBlock:^(__unused NSUInteger index, __unused BOOL isDeleted,
+                                                        __unused NSArray *changes, __unused NSError *error) {
+        XCTFail(@"should not be called after the token is invalidated");
+    } toObjects:objects keyPaths:nil queue:self.bgQueue];
+    [tokens makeObjectsPerformSelector:@selector(invalidate)];
+    [realm transactionWithBlock:^{
+        [realm deleteObject:objects[0]];
+    }];
+    dispatch_resume(self.bgQueue);
+    dispatch_sync(self.bgQueue, ^{});
+
+    [realm transactionWithBlock:^{
+        [objects[1] setIntCol:10];
+    }];
+    dispatch_sync(self.bgQueue, ^{});
+}
+
 @end
 
 static void ExpectObjectChange(RLMTestCase<ChangesetTestCase> *self, void (^block)(RLMRealm *realm)) {
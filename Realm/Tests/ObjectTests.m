@@ -117,6 +117,17 @@ RLM_COLLECTION_TYPE(CycleObject)
 }
 @end
 
+@interface InternedStringObject : RLMObject
+@property NSString *status;
+@property NSString *name;
+@end
+
+@implementation InternedStringObject
++ (NSArray *)internedStringProperties {
+    return @[@"status"];
+}
+@end
+
 @interface StringSubclassObject : StringObject
 @property NSString *stringCol2;
 @end
@@ -1071,6 +1082,169 @@ static void addProperty(Class cls, const char *name, const char *type, size_t si
     XCTAssertFalse([obj isEqualToObject:[BoolObject allObjects][0]], @"Different tables.");
 }
 
+- (void)testHashingObjectsWithPrimaryKey {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    PrimaryIntObject *obj1 = [PrimaryIntObject createInRealm:realm withValue:@[@1]];
+    PrimaryIntObject *obj2 = [PrimaryIntObject createInRealm:realm withValue:@[@2]];
+    [realm commitWriteTransaction];
+
+    PrimaryIntObject *obj1Copy = [PrimaryIntObject objectInRealm:realm forPrimaryKey:@1];
+    XCTAssertNotEqual(obj1, obj1Copy);
+    XCTAssertEqualObjects(obj1, obj1Copy);
+    XCTAssertEqual(obj1.hash, obj1Copy.hash);
+    XCTAssertNotEqualObjects(obj1, obj2);
+
+    NSSet *set = [NSSet setWithObjects:obj1, obj2, obj1Copy, nil];
+    XCTAssertEqual(set.count, 2U);
+    XCTAssertTrue([set containsObject:[PrimaryIntObject objectInRealm:realm forPrimaryKey:@2]]);
+
+    // Unmanaged objects are only equal to themselves
+    PrimaryIntObject *unmanaged = [[PrimaryIntObject alloc] initWithValue:@[@1]];
+    XCTAssertNotEqualObjects(unmanaged, obj1);
+    XCTAssertFalse([set containsObject:unmanaged]);
+
+    // The hash is the same before and after adding the object to a Realm
+    PrimaryIntObject *added = [[PrimaryIntObject alloc] initWithValue:@[@3]];
+    NSUInteger hash = added.hash;
+    [realm beginWriteTransaction];
+    [realm addObject:added];
+    [realm commitWriteTransaction];
+    XCTAssertEqual(added.hash, hash);
+    XCTAssertEqual([PrimaryIntObject objectInRealm:realm forPrimaryKey:@3].hash, hash);
+
+    // Deleted objects can still be hashed, and keep the hash they had
+    // before being deleted
+    NSUInteger obj2Hash = obj2.hash;
+    [realm beginWriteTransaction];
+    [realm deleteObject:obj2];
+    [realm commitWriteTransaction];
+    XCTAssertEqual(obj2.hash, obj2Hash);
+    XCTAssertTrue([set containsObject:obj2]);
+    XCTAssertNotEqualObjects(obj2, [PrimaryIntObject objectInRealm:realm forPrimaryKey:@1]);
+
+    // Accessors reused for each element of an enumeration hash to the
+    // element they currently point at
+    NSMutableArray *hashes = [NSMutableArray new];
+    RLMResults *sorted = [[PrimaryIntObject allObjectsInRealm:realm] sortedResultsUsingKeyPath:@"intCol" ascending:YES];
+    for (PrimaryIntObject *obj in [sorted objectsReusingAccessors]) {
+        [hashes addObject:@(obj.hash)];
+    }
+    XCTAssertEqualObjects(hashes, (@[@(obj1.hash), @(hash)]));
+}
+
+- (void)testInternedStringProperties {
+    RLMObjectSchema *objectSchema = InternedStringObject.sharedSchema;
+    XCTAssertTrue(objectSchema[@"status"].interned);
+    XCTAssertFalse(objectSchema[@"name"].interned);
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    InternedStringObject *obj1 = [InternedStringObject createInRealm:realm withValue:@[@"active account status", @"a"]];
+    InternedStringObject *obj2 = [InternedStringObject createInRealm:realm withValue:@[@"active account status", @"a"]];
+    InternedStringObject *obj3 = [InternedStringObject createInRealm:realm withValue:@[@"inactive account status", @"b"]];
+    InternedStringObject *obj4 = [InternedStringObject createInRealm:realm withValue:@[NSNull.null, NSNull.null]];
+    [realm commitWriteTransaction];
+
+    // Long enough to not be a tagged pointer, so identical pointers means
+    // that the value came from the cache
+    XCTAssertEqualObjects(obj1.status, @"active account status");
+    XCTAssertEqual(obj1.status, obj2.status);
+    XCTAssertEqual(obj1.status, obj1.status);
+    XCTAssertEqualObjects(obj3.status, @"inactive account status");
+    XCTAssertNotEqual(obj1.status, obj3.status);
+    XCTAssertNil(obj4.status);
+    XCTAssertEqualObjects(obj1.name, obj2.name);
+
+    // Changing a value reads the new value rather than the cached one
+    [realm beginWriteTransaction];
+    obj2.status = @"inactive account status";
+    [realm commitWriteTransaction];
+    XCTAssertEqualObjects(obj2.status, @"inactive account status");
+    XCTAssertEqual(obj2.status, obj3.status);
+    XCTAssertEqualObjects(obj1.status, @"active account status");
+
+    // Values beyond the cache's capacity are still read correctly
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 300; ++i) {
+        [InternedStringObject createInRealm:realm withValue:@[[NSString stringWithFormat:@"status %d", i], @""]];
+    }
+    [realm commitWriteTransaction];
+    RLMResults<InternedStringObject *> *objects = [InternedStringObject objectsWhere:@"status BEGINSWITH 'status '"];
+    for (int i = 0; i < 300; ++i) {
+        XCTAssertEqualObjects(objects[i].status, ([NSString stringWithFormat:@"status %d", i]));
+    }
+    XCTAssertEqual(obj1.status, obj1.status);
+
+    // Frozen objects don't use the cache but still read the correct value
+    InternedStringObject *frozen = obj1.freeze;
+    XCTAssertEqualObjects(frozen.status, @"active account status");
+}
+
+- (void)testWithUnsafeBytesForProperty {
+    __block NSData *read;
+    void (^readBytes)(const void *, NSUInteger) = ^(const void *bytes, NSUInteger length) {
+        read = bytes ? [NSData dataWithBytes:bytes length:length] : nil;
+    };
+
+    StringObject *unmanagedString = [[StringObject alloc] initWithValue:@[@"héllo"]];
+    [unmanagedString withUnsafeBytesForProperty:@"stringCol" block:readBytes];
+    XCTAssertEqualObjects(read, [@"héllo" dataUsingEncoding:NSUTF8StringEncoding]);
+
+    // Embedded nulls are not treated as the end of the string
+    NSString *withNull = [[NSString alloc] initWithBytes:"a\0b" length:3 encoding:NSUTF8StringEncoding];
+    [[[StringObject alloc] initWithValue:@[withNull]] withUnsafeBytesForProperty:@"stringCol" block:readBytes];
+    XCTAssertEqualObjects(read, [NSData dataWithBytes:"a\0b" length:3]);
+
+    NSData *data = [NSData dataWithBytes:"\0\1\2\3" length:4];
+    BinaryObject *unmanagedBinary = [[BinaryObject alloc] initWithValue:@[data]];
+    [unmanagedBinary withUnsafeBytesForProperty:@"binaryCol" block:readBytes];
+    XCTAssertEqualObjects(read, data);
+
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    StringObject *so = [StringObject createInRealm:realm withValue:@[@"héllo"]];
+    StringObject *nilString = [StringObject createInRealm:realm withValue:@[NSNull.null]];
+    BinaryObject *bo = [BinaryObject createInRealm:realm withValue:@[data]];
+    BinaryObject *emptyBinary = [BinaryObject createInRealm:realm withValue:@[NSData.data]];
+    [realm commitWriteTransaction];
+
+    [so withUnsafeBytesForProperty:@"stringCol" block:readBytes];
+    XCTAssertEqualObjects(read, [@"héllo" dataUsingEncoding:NSUTF8StringEncoding]);
+    [bo withUnsafeBytesForProperty:@"binaryCol" block:readBytes];
+    XCTAssertEqualObjects(read, data);
+
+    __block BOOL called = NO;
+    [nilString withUnsafeBytesForProperty:@"stringCol" block:^(const void *bytes, NSUInteger length) {
+        XCTAssertEqual(bytes, NULL);
+        XCTAssertEqual(length, 0U);
+        called = YES;
+    }];
+    XCTAssertTrue(called);
+    [emptyBinary withUnsafeBytesForProperty:@"binaryCol" block:^(const void *bytes, NSUInteger length) {
+        XCTAssertNotEqual(bytes, NULL);
+        XCTAssertEqual(length, 0U);
+    }];
+
+    // Auto-refresh is suspended while the block runs and restored afterwards
+    XCTAssertTrue(realm.autorefresh);
+    [so withUnsafeBytesForProperty:@"stringCol" block:^(__unused const void *bytes, __unused NSUInteger length) {
+        XCTAssertFalse(realm.autorefresh);
+    }];
+    XCTAssertTrue(realm.autorefresh);
+
+    RLMAssertThrowsWithReason([so withUnsafeBytesForProperty:@"invalid" block:readBytes],
+                              @"Invalid property name 'invalid' for class 'StringObject'.");
+    RLMAssertThrowsWithReason([[IntObject new] withUnsafeBytesForProperty:@"intCol" block:readBytes],
+                              @"Property 'intCol' on 'IntObject' is of type 'int': only string and data properties can be read as bytes.");
+
+    [realm beginWriteTransaction];
+    [realm deleteObject:so];
+    [realm commitWriteTransaction];
+    RLMAssertThrowsWithReason([so withUnsafeBytesForProperty:@"stringCol" block:readBytes],
+                              @"Object has been deleted or invalidated.");
+}
+
 - (void)testCrossThreadAccess {
     IntObject *obj = [[IntObject alloc] init];
 
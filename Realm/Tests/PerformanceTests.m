@@ -18,11 +18,30 @@
 
 #import "RLMTestCase.h"
 
+#import "RLMObjectSchema_Private.h"
+#import "RLMProperty_Private.h"
 #import "RLMRealm_Dynamic.h"
 #import "RLMRealm_Private.h"
+#import "RLMSchema_Private.h"
+
+#import <fcntl.h>
 
 #if !DEBUG && TARGET_OS_IPHONE && !TARGET_IPHONE_SIMULATOR
 
+@interface StatusObject : RLMObject
+@property NSString *status;
+@end
+@implementation StatusObject
+@end
+
+@interface InternedStatusObject : StatusObject
+@end
+@implementation InternedStatusObject
++ (NSArray *)internedStringProperties {
+    return @[@"status"];
+}
+@end
+
 @interface PerformanceTests : RLMTestCase
 @property (nonatomic) dispatch_queue_t queue;
 @property (nonatomic) dispatch_semaphore_t sema;
@@ -103,6 +122,42 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testInsertMultipleBulk {
+    [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
+        RLMRealm *realm = self.realmWithTestPath;
+        NSMutableArray *objects = [NSMutableArray arrayWithCapacity:500000];
+        for (int i = 0; i < 500000; ++i) {
+            StringObject *obj = [[StringObject alloc] init];
+            obj.stringCol = @"a";
+            [objects addObject:obj];
+        }
+
+        [self startMeasuring];
+        [realm beginWriteTransaction];
+        [realm addObjects:objects];
+        [realm commitWriteTransaction];
+        [self stopMeasuring];
+        [self tearDown];
+    }];
+}
+
+- (void)testImportJSON {
+    NSMutableData *json = [NSMutableData new];
+    for (int i = 0; i < 500000; ++i) {
+        [json appendBytes:"{\"stringCol\": \"a\"}\n" length:19];
+    }
+
+    [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
+        RLMRealm *realm = self.realmWithTestPath;
+        NSInputStream *stream = [NSInputStream inputStreamWithData:json];
+
+        [self startMeasuring];
+        [realm importObjectsOfClass:@"StringObject" fromJSONStream:stream options:nil error:nil];
+        [self stopMeasuring];
+        [self tearDown];
+    }];
+}
+
 - (void)testInsertSingleLiteral {
     [self measureBlock:^{
         RLMRealm *realm = self.realmWithTestPath;
@@ -177,6 +232,47 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testEnumerateAndAccessAllReusingAccessors {
+    RLMRealm *realm = [self getStringObjects:50];
+
+    [self measureBlock:^{
+        for (StringObject *so in [[StringObject allObjectsInRealm:realm] objectsReusingAccessors]) {
+            (void)[so stringCol];
+        }
+    }];
+}
+
+- (RLMRealm *)realmWithStatusObjects:(Class)cls {
+    NSArray *statuses = @[@"pending review", @"approved by reviewer", @"rejected by reviewer"];
+    RLMRealm *realm = self.testRealm;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 100000; ++i) {
+        [cls createInRealm:realm withValue:@[statuses[i % 3]]];
+    }
+    [realm commitWriteTransaction];
+    return realm;
+}
+
+- (void)measureEnumeratingStatusObjects:(Class)cls {
+    RLMRealm *realm = [self realmWithStatusObjects:cls];
+    NSString *approved = @"approved by reviewer";
+    [self measureBlock:^{
+        NSUInteger count = 0;
+        for (StatusObject *obj in [[cls allObjectsInRealm:realm] objectsReusingAccessors]) {
+            count += [obj.status isEqual:approved];
+        }
+        XCTAssertEqual(count, 33333U);
+    }];
+}
+
+- (void)testEnumerateAndAccessLowCardinalityString {
+    [self measureEnumeratingStatusObjects:StatusObject.class];
+}
+
+- (void)testEnumerateAndAccessInternedString {
+    [self measureEnumeratingStatusObjects:InternedStatusObject.class];
+}
+
 - (void)testEnumerateAndAccessAllTV {
     RLMRealm *realm = [self getStringObjects:50];
 
@@ -319,6 +415,20 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testQueryConstructionWithoutCache {
+    RLMRealm *realm = self.realmWithTestPath;
+    NSPredicate *predicate = [NSPredicate predicateWithFormat:@"boolCol = false and (intCol = 5 or floatCol = 1.0) and objectCol = nil and longCol != 7 and stringCol IN {'a', 'b', 'c'}"];
+
+    NSUInteger capacity = RLMRealm.queryCacheCapacity;
+    RLMRealm.queryCacheCapacity = 0;
+    [self measureBlock:^{
+        for (int i = 0; i < 5000; ++i) {
+            [AllTypesObject objectsInRealm:realm withPredicate:predicate];
+        }
+    }];
+    RLMRealm.queryCacheCapacity = capacity;
+}
+
 - (void)testDeleteAll {
     [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
         RLMRealm *realm = [self getStringObjects:50];
@@ -360,6 +470,26 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testManualDeletionOfMultipleTypes {
+    [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
+        RLMRealm *realm = self.realmWithTestPath;
+        NSMutableArray *objects = [NSMutableArray arrayWithCapacity:50000];
+        [realm beginWriteTransaction];
+        for (int i = 0; i < 25000; ++i) {
+            [objects addObject:[StringObject createInRealm:realm withValue:@[@"a"]]];
+            [objects addObject:[IntObject createInRealm:realm withValue:@[@(i)]]];
+        }
+        [realm commitWriteTransaction];
+
+        [self startMeasuring];
+        [realm beginWriteTransaction];
+        [realm deleteObjects:objects];
+        [realm commitWriteTransaction];
+        [self stopMeasuring];
+        [self tearDown];
+    }];
+}
+
 - (void)testUnIndexedStringLookup {
     RLMRealm *realm = self.realmWithTestPath;
     [realm beginWriteTransaction];
@@ -420,6 +550,136 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (RLMResults *)aggregateObjects {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 300000; ++i) {
+        [AggregateObject createInRealm:realm withValue:@[@(i), @(i * 1.5f), @(i * 2.5), @(i % 2), NSDate.date]];
+    }
+    [realm commitWriteTransaction];
+    return [AggregateObject objectsInRealm:realm where:@"boolCol == YES"];
+}
+
+- (void)testAggregatePropertiesSeparately {
+    RLMResults *results = [self aggregateObjects];
+    [self measureBlock:^{
+        for (NSString *property in @[@"intCol", @"floatCol", @"doubleCol"]) {
+            (void)[results minOfProperty:property];
+            (void)[results maxOfProperty:property];
+            (void)[results sumOfProperty:property];
+            (void)[results averageOfProperty:property];
+        }
+    }];
+}
+
+- (void)testAggregatePropertiesInOnePass {
+    RLMResults *results = [self aggregateObjects];
+    [self measureBlock:^{
+        RLMAggregateResult aggregates[3];
+        [results aggregateProperties:@[@"intCol", @"floatCol", @"doubleCol"] into:aggregates];
+    }];
+}
+
+- (RLMResults *)objectsToDescribe {
+    RLMRealm *realm = self.realmWithTestPath;
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 1000; ++i) {
+        [AggregateObject createInRealm:realm withValue:@[@(i), @(i * 1.5f), @(i * 2.5), @(i % 2), NSDate.date]];
+    }
+    [realm commitWriteTransaction];
+    return [AggregateObject allObjectsInRealm:realm];
+}
+
+- (void)testResultsDescription {
+    RLMResults *results = [self objectsToDescribe];
+    [self measureBlock:^{
+        for (int i = 0; i < 10; ++i) {
+            (void)results.description;
+        }
+    }];
+}
+
+- (void)testResultsWriteDescription {
+    RLMResults *results = [self objectsToDescribe];
+    // Limit the output to the same number of objects as `description`
+    RLMDescriptionOptions *options = [RLMDescriptionOptions new];
+    options.maxObjects = 100;
+    int fd = open("/dev/null", O_WRONLY);
+    [self measureBlock:^{
+        for (int i = 0; i < 10; ++i) {
+            [results writeDescriptionToFileDescriptor:fd options:options error:nil];
+        }
+    }];
+    close(fd);
+}
+
+// Create a Realm where StringObject.stringCol is an int so that opening it
+// with the real schema requires a migration
+- (RLMRealmConfiguration *)configurationRequiringStringObjectMigration {
+    RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:StringObject.class];
+    objectSchema.objectClass = RLMObject.class;
+    objectSchema.properties[0].type = RLMPropertyTypeInt;
+    objectSchema.properties[0].optional = NO;
+    RLMSchema *schema = [[RLMSchema alloc] init];
+    schema.objectSchema = @[objectSchema];
+
+    RLMRealm *realm = [self realmWithTestPathAndSchema:schema];
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 200000; ++i) {
+        [realm createObject:StringObject.className withValue:@[@(i)]];
+    }
+    [realm commitWriteTransaction];
+    realm = nil;
+    [RLMRealm resetRealmState];
+
+    RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+    config.fileURL = RLMTestRealmURL();
+    config.objectClasses = @[StringObject.class];
+    config.schemaVersion = 1;
+    return config;
+}
+
+- (void)measureStringObjectMigration:(RLMMigrationBlock)block {
+    [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
+        RLMRealmConfiguration *config = [self configurationRequiringStringObjectMigration];
+        config.migrationBlock = block;
+        [self startMeasuring];
+        [RLMRealm performMigrationForConfiguration:config error:nil];
+        [self stopMeasuring];
+        [self tearDown];
+    }];
+}
+
+- (void)testMigrationEnumerateObjects {
+    [self measureStringObjectMigration:^(RLMMigration *migration, __unused uint64_t oldSchemaVersion) {
+        [migration enumerateObjects:StringObject.className block:^(RLMObject *oldObject, RLMObject *newObject) {
+            newObject[@"stringCol"] = [oldObject[@"stringCol"] stringValue];
+        }];
+    }];
+}
+
+- (void)testMigrationTransformObjects {
+    [self measureStringObjectMigration:^(RLMMigration *migration, __unused uint64_t oldSchemaVersion) {
+        [migration transformObjects:StringObject.className batchSize:10000 block:^(NSDictionary *oldValues) {
+            return @{@"stringCol": [oldValues[@"stringCol"] stringValue]};
+        }];
+    }];
+}
+
+- (void)testMigrationTransformProperty {
+    [self measureStringObjectMigration:^(RLMMigration *migration, __unused uint64_t oldSchemaVersion) {
+        [migration transformProperty:@"stringCol" ofClass:StringObject.className using:^(id<RLMValue> oldValue) {
+            return [(NSNumber *)oldValue stringValue];
+        }];
+    }];
+}
+
+- (void)testMigrationCopyValuesOfProperty {
+    [self measureStringObjectMigration:^(RLMMigration *migration, __unused uint64_t oldSchemaVersion) {
+        [migration copyValuesOfProperty:@"stringCol" toProperty:@"stringCol" ofClass:StringObject.className];
+    }];
+}
+
 - (void)testRealmCreationCached {
     __block RLMRealm *realm;
     [self dispatchAsyncAndWait:^{
@@ -461,6 +721,25 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testConcurrentRealmFileCreation {
+    __block int measurement = 0;
+    const int threads = 8;
+    const int iterations = 25;
+    [self measureBlock:^{
+        // Each thread opens different files, so the opens should not block each other
+        dispatch_apply(threads, DISPATCH_APPLY_AUTO, ^(size_t thread) {
+            RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+            for (int i = 0; i < iterations; ++i) {
+                @autoreleasepool {
+                    config.inMemoryIdentifier = [NSString stringWithFormat:@"%d-%zu-%d", measurement, thread, i];
+                    [RLMRealm realmWithConfiguration:config error:nil];
+                }
+            }
+        });
+        ++measurement;
+    }];
+}
+
 - (void)testInvalidateRefresh {
     RLMRealm *realm = [self testRealm];
     [self measureBlock:^{
@@ -648,6 +927,65 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testRegisterFilteredObjectNotifiers {
+    RLMRealm *realm = [self getStringObjects:1];
+    RLMResults *objects = [StringObject allObjectsInRealm:realm];
+    RLMKeyPathFilter *filter = [RLMKeyPathFilter filterWithKeyPaths:@[@"stringCol"]];
+    [self measureBlock:^{
+        NSMutableArray *tokens = [NSMutableArray new];
+        for (StringObject *so in objects) {
+            [tokens addObject:[so addNotificationBlock:^(__unused BOOL deleted, __unused NSArray *changes, __unused NSError *error) {
+            } keyPaths:filter]];
+        }
+        for (RLMNotificationToken *token in tokens) {
+            [token invalidate];
+        }
+    }];
+}
+
+- (NSArray *)objectsToObserveOnQueue {
+    RLMRealm *realm = [self getStringObjects:1];
+    NSMutableArray *objects = [NSMutableArray new];
+    for (StringObject *so in [StringObject allObjectsInRealm:realm]) {
+        [objects addObject:so];
+        if (objects.count == 1000) {
+            break;
+        }
+    }
+    return objects;
+}
+
+- (void)testRegisterObjectNotifiersOnQueue {
+    NSArray *objects = [self objectsToObserveOnQueue];
+    dispatch_queue_t queue = dispatch_queue_create("queue", DISPATCH_QUEUE_SERIAL);
+    [self measureBlock:^{
+        NSMutableArray *tokens = [NSMutableArray new];
+        for (StringObject *so in objects) {
+            [tokens addObject:[so addNotificationBlock:^(__unused BOOL deleted, __unused NSArray *changes, __unused NSError *error) {
+            } queue:queue]];
+        }
+        // Wait for the registrations to happen on the queue
+        dispatch_sync(queue, ^{});
+        for (RLMNotificationToken *token in tokens) {
+            [token invalidate];
+        }
+    }];
+}
+
+- (void)testRegisterObjectNotifiersOnQueueBatched {
+    NSArray *objects = [self objectsToObserveOnQueue];
+    dispatch_queue_t queue = dispatch_queue_create("queue", DISPATCH_QUEUE_SERIAL);
+    [self measureBlock:^{
+        NSArray *tokens = [StringObject addNotificationBlock:^(__unused NSUInteger index, __unused BOOL deleted,
+                                                               __unused NSArray *changes, __unused NSError *error) {
+        } toObjects:objects keyPaths:nil queue:queue];
+        dispatch_sync(queue, ^{});
+        for (RLMNotificationToken *token in tokens) {
+            [token invalidate];
+        }
+    }];
+}
+
 - (void)testCrossThreadSyncLatency {
     const int stopValue = 5000;
 
@@ -707,9 +1045,72 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)measureSetterWithObservedObjectCount:(NSUInteger)observedCount {
+    RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+    config.inMemoryIdentifier = [NSString stringWithFormat:@"observed %@", @(observedCount)];
+    RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:nil];
+
+    const NSUInteger setterCount = 1000;
+    [realm beginWriteTransaction];
+    for (NSUInteger i = 0; i < observedCount + setterCount; ++i) {
+        [IntObject createInRealm:realm withValue:@[@0]];
+    }
+    [realm commitWriteTransaction];
+
+    RLMResults *all = [IntObject allObjectsInRealm:realm];
+    NSMutableArray *observed = [NSMutableArray arrayWithCapacity:observedCount];
+    NSMutableArray *targets = [NSMutableArray arrayWithCapacity:setterCount];
+    for (NSUInteger i = 0; i < observedCount; ++i) {
+        IntObject *obj = all[i];
+        [obj addObserver:self forKeyPath:@"intCol" options:(NSKeyValueObservingOptions)0 context:nil];
+        [observed addObject:obj];
+    }
+    for (NSUInteger i = observedCount; i < observedCount + setterCount; ++i) {
+        [targets addObject:all[i]];
+    }
+
+    // Each setter on an unobserved accessor has to check if the row is observed
+    // via some other accessor
+    [self measureBlock:^{
+        [realm beginWriteTransaction];
+        for (IntObject *obj in targets) {
+            obj.intCol++;
+        }
+        [realm cancelWriteTransaction];
+    }];
+
+    for (IntObject *obj in observed) {
+        [obj removeObserver:self forKeyPath:@"intCol" context:nil];
+    }
+}
+
+- (void)testSetterWith10ObservedObjects {
+    [self measureSetterWithObservedObjectCount:10];
+}
+
+- (void)testSetterWith1000ObservedObjects {
+    [self measureSetterWithObservedObjectCount:1000];
+}
+
+- (void)testSetterWith10000ObservedObjects {
+    [self measureSetterWithObservedObjectCount:10000];
+}
+
+- (void)testSetterWith100000ObservedObjects {
+    [self measureSetterWithObservedObjectCount:100000];
+}
+
 - (void)testArrayKVOIndexHandlingRemoveForward {
+    [self measureArrayKVORemoveForward:50];
+}
+
+- (void)testArrayKVOIndexHandlingRemoveForward100k {
+    [self measureArrayKVORemoveForward:5];
+}
+
+- (void)measureArrayKVORemoveForward:(int)factor {
     [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
-        RLMRealm *realm = [self getStringObjects:50];
+        RLMRealm *realm = [self getStringObjects:factor];
         [realm beginWriteTransaction];
         ArrayPropertyObject *obj = [ArrayPropertyObject createInRealm:realm withValue:@[@"", [StringObject allObjectsInRealm:realm], @[]]];
         [realm commitWriteTransaction];
@@ -729,8 +1130,16 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
 }
 
 - (void)testArrayKVOIndexHandlingRemoveBackwards {
+    [self measureArrayKVORemoveBackwards:50];
+}
+
+- (void)testArrayKVOIndexHandlingRemoveBackwards100k {
+    [self measureArrayKVORemoveBackwards:5];
+}
+
+- (void)measureArrayKVORemoveBackwards:(int)factor {
     [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
-        RLMRealm *realm = [self getStringObjects:50];
+        RLMRealm *realm = [self getStringObjects:factor];
         [realm beginWriteTransaction];
         ArrayPropertyObject *obj = [ArrayPropertyObject createInRealm:realm withValue:@[@"", [StringObject allObjectsInRealm:realm], @[]]];
         [realm commitWriteTransaction];
@@ -752,6 +1161,31 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
     }];
 }
 
+- (void)testArrayKVOIndexHandlingDeleteLinkedObjects100k {
+    [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
+        RLMRealm *realm = [self getStringObjects:5];
+        RLMResults *targets = [StringObject allObjectsInRealm:realm];
+        [realm beginWriteTransaction];
+        ArrayPropertyObject *obj = [ArrayPropertyObject createInRealm:realm withValue:@[@"", targets, @[]]];
+        [realm commitWriteTransaction];
+
+        NSMutableArray *toDelete = [NSMutableArray new];
+        for (NSUInteger i = 0; i < targets.count; i += 100) {
+            [toDelete addObject:targets[i]];
+        }
+
+        // Observed on this thread, so the removed indexes are computed by the
+        // observation tracker's cascade notification handler
+        [obj addObserver:self forKeyPath:@"array" options:(NSKeyValueObservingOptions)0 context:nil];
+        [self startMeasuring];
+        [realm beginWriteTransaction];
+        [realm deleteObjects:toDelete];
+        [realm commitWriteTransaction];
+        [self stopMeasuring];
+        [obj removeObserver:self forKeyPath:@"array" context:nil];
+    }];
+}
+
 - (void)testArrayKVOIndexHandlingInsertCompact {
     [self measureMetrics:self.class.defaultPerformanceMetrics automaticallyStartMeasuring:NO forBlock:^{
         RLMRealm *realm = [self getStringObjects:50];
@@ -945,7 +1379,9 @@ static RLMRealm *s_smallRealm, *s_mediumRealm, *s_largeRealm;
                       ofObject:(__unused id)object
                         change:(__unused NSDictionary *)change
                        context:(void *)context {
-    dispatch_semaphore_signal((__bridge dispatch_semaphore_t)context);
+    if (context) {
+        dispatch_semaphore_signal((__bridge dispatch_semaphore_t)context);
+    }
 }
 
 @end
@@ -487,6 +487,69 @@
     XCTAssertEqualObjects([results[0] name], @"Tim", @"Tim should be first results");
 }
 
+- (void)testQueryCache {
+    RLMRealm *realm = [self realm];
+
+    [realm beginWriteTransaction];
+    [PersonObject createInRealm:realm withValue:@[@"Fiel", @27]];
+    [PersonObject createInRealm:realm withValue:@[@"Ari", @33]];
+    [realm commitWriteTransaction];
+
+    [RLMRealm resetQueryCacheStatistics];
+    XCTAssertEqual(1U, [PersonObject objectsInRealm:realm where:@"age > 28"].count);
+    XCTAssertEqual(0U, RLMRealm.queryCacheHitCount);
+    XCTAssertEqual(1U, RLMRealm.queryCacheMissCount);
+    XCTAssertEqual(1U, [PersonObject objectsInRealm:realm where:@"age > 28"].count);
+    XCTAssertEqual(1U, RLMRealm.queryCacheHitCount);
+    XCTAssertEqual(1U, RLMRealm.queryCacheMissCount);
+
+    // Filtering existing Results uses the same cache
+    XCTAssertEqual(1U, [[PersonObject allObjectsInRealm:realm] objectsWhere:@"age > 28"].count);
+    XCTAssertEqual(2U, RLMRealm.queryCacheHitCount);
+
+    // Predicates which differ only in their constant values share an entry,
+    // and the constants are applied to the query each time
+    XCTAssertEqual(1U, [PersonObject objectsInRealm:realm where:@"age > %@", @28.5].count);
+    XCTAssertEqual(3U, RLMRealm.queryCacheHitCount);
+    XCTAssertEqual(2U, [PersonObject objectsInRealm:realm where:@"age > %@", @20].count);
+    XCTAssertEqual(4U, RLMRealm.queryCacheHitCount);
+    XCTAssertEqual(1U, RLMRealm.queryCacheMissCount);
+
+    // Different operators are a different shape
+    XCTAssertEqual(1U, [PersonObject objectsInRealm:realm where:@"age < %@", @30].count);
+    XCTAssertEqual(2U, RLMRealm.queryCacheMissCount);
+
+    // Constants of different types which compare equal share an entry
+    [realm beginWriteTransaction];
+    [MixedObject createInRealm:realm withValue:@[[RLMDecimal128 decimalWithNumber:@5]]];
+    [realm commitWriteTransaction];
+    XCTAssertEqual(1U, [MixedObject objectsInRealm:realm where:@"anyCol = %@", [RLMDecimal128 decimalWithNumber:@5]].count);
+    XCTAssertEqual(3U, RLMRealm.queryCacheMissCount);
+    [MixedObject objectsInRealm:realm where:@"anyCol = %@", @5];
+    XCTAssertEqual(3U, RLMRealm.queryCacheMissCount);
+    XCTAssertEqual(5U, RLMRealm.queryCacheHitCount);
+
+    // Mutable values are read each time the predicate is used
+    NSMutableString *name = [@"Ari" mutableCopy];
+    XCTAssertEqual(1U, [PersonObject objectsInRealm:realm where:@"name = %@", name].count);
+    [name setString:@"Fiel"];
+    XCTAssertEqualObjects(@"Fiel", [[PersonObject objectsInRealm:realm where:@"name = %@", name].firstObject name]);
+    XCTAssertEqual(6U, RLMRealm.queryCacheHitCount);
+    XCTAssertEqual(4U, RLMRealm.queryCacheMissCount);
+
+    // Invalidating the Realm discards the cached queries
+    [realm invalidate];
+    XCTAssertEqual(1U, [PersonObject objectsInRealm:realm where:@"age > 28"].count);
+    XCTAssertEqual(5U, RLMRealm.queryCacheMissCount);
+
+    NSUInteger capacity = RLMRealm.queryCacheCapacity;
+    RLMRealm.queryCacheCapacity = 0;
+    XCTAssertEqual(1U, [PersonObject objectsInRealm:realm where:@"age > 28"].count);
+    XCTAssertEqual(6U, RLMRealm.queryCacheHitCount);
+    XCTAssertEqual(5U, RLMRealm.queryCacheMissCount);
+    RLMRealm.queryCacheCapacity = capacity;
+}
+
 - (void)testQueryBetween {
     RLMRealm *realm = [self realm];
 
@@ -776,6 +776,71 @@
     XCTAssertEqual(1U, CompanyObject.allObjects.count);
 }
 
+- (void)testDeleteObjectsOfMultipleClasses {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+
+    [realm beginWriteTransaction];
+    NSMutableArray *objects = [NSMutableArray new];
+    for (int i = 0; i < 5; ++i) {
+        [objects addObject:[OwnerObject createInRealm:realm withValue:@[@"owner", @[@"dog", @(i)]]]];
+        [objects addObject:[IntObject createInRealm:realm withValue:@[@(i)]]];
+    }
+    IntObject *kept = [IntObject createInRealm:realm withValue:@[@10]];
+    [realm commitWriteTransaction];
+
+    // Objects which are listed twice or already deleted are skipped
+    [objects addObject:objects[0]];
+    [realm beginWriteTransaction];
+    [realm deleteObject:objects[1]];
+    [realm deleteObjects:objects];
+    [realm commitWriteTransaction];
+
+    for (RLMObject *obj in objects) {
+        XCTAssertTrue(obj.invalidated);
+    }
+    XCTAssertFalse(kept.invalidated);
+    XCTAssertEqual(0U, [OwnerObject allObjectsInRealm:realm].count);
+    XCTAssertEqual(5U, [DogObject allObjectsInRealm:realm].count);
+    XCTAssertEqual(1U, [IntObject allObjectsInRealm:realm].count);
+
+    // Nothing is deleted if any object is invalid
+    [realm beginWriteTransaction];
+    RLMAssertThrowsWithReason([realm deleteObjects:@[kept, [IntObject new]]],
+                              @"Can only delete an object from the Realm it belongs to.");
+    RLMAssertThrowsWithReason([realm deleteObjects:@[kept, @1]],
+                              @"Cannot delete objects of type __NSCFNumber with deleteObjects:");
+    [realm commitWriteTransaction];
+    XCTAssertFalse(kept.invalidated);
+
+    // Deleting an empty collection does not require a write transaction
+    XCTAssertNoThrow([realm deleteObjects:@[]]);
+}
+
+- (void)testDeleteObjectsWithEmbeddedChildren {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+
+    [realm beginWriteTransaction];
+    EmbeddedIntParentObject *parent1 = [EmbeddedIntParentObject createInRealm:realm withValue:@[@1, @[@2], @[@[@3]]]];
+    EmbeddedIntParentObject *parent2 = [EmbeddedIntParentObject createInRealm:realm withValue:@[@4, @[@5], @[@[@6]]]];
+    EmbeddedIntObject *child1 = parent1.object;
+    EmbeddedIntObject *arrayChild1 = parent1.array[0];
+    EmbeddedIntObject *child2 = parent2.object;
+
+    // The parent's deletion cascades to the children, which must then be
+    // skipped rather than deleted a second time
+    XCTAssertNoThrow([realm deleteObjects:@[parent1, child1, arrayChild1]]);
+    XCTAssertTrue(parent1.invalidated);
+    XCTAssertTrue(child1.invalidated);
+    XCTAssertTrue(arrayChild1.invalidated);
+
+    XCTAssertNoThrow([realm deleteObjects:@[child2, parent2]]);
+    XCTAssertTrue(parent2.invalidated);
+    XCTAssertTrue(child2.invalidated);
+    [realm commitWriteTransaction];
+
+    XCTAssertEqual(0U, [EmbeddedIntParentObject allObjectsInRealm:realm].count);
+}
+
 - (void)testDeleteAllObjects {
     RLMRealm *realm = [RLMRealm defaultRealm];
 
@@ -813,6 +878,164 @@
     [realm cancelWriteTransaction];
 }
 
+- (void)testAddObjectsOfMultipleClasses {
+    RLMRealm *realm = [self realmWithTestPath];
+
+    NSMutableArray *objects = [NSMutableArray new];
+    for (int i = 0; i < 10; ++i) {
+        [objects addObject:[[PrimaryIntObject alloc] initWithValue:@[@(i)]]];
+        [objects addObject:[[PrimaryStringObject alloc] initWithValue:@[@(i).stringValue, @(i)]]];
+    }
+
+    [realm beginWriteTransaction];
+    [realm addObjects:objects];
+    XCTAssertEqual(10U, [PrimaryIntObject allObjectsInRealm:realm].count);
+    XCTAssertEqual(10U, [PrimaryStringObject allObjectsInRealm:realm].count);
+    for (RLMObject *obj in objects) {
+        XCTAssertEqual(obj.realm, realm);
+    }
+
+    // Adding objects which are already managed is a no-op
+    XCTAssertNoThrow([realm addObjects:objects]);
+    XCTAssertEqual(10U, [PrimaryIntObject allObjectsInRealm:realm].count);
+
+    NSArray *updates = @[[[PrimaryStringObject alloc] initWithValue:@[@"1", @10]],
+                         [[PrimaryIntObject alloc] initWithValue:@[@20]],
+                         [[PrimaryStringObject alloc] initWithValue:@[@"2", @20]]];
+    [realm addOrUpdateObjects:updates];
+    XCTAssertEqual(10U, [PrimaryStringObject allObjectsInRealm:realm].count);
+    XCTAssertEqual(11U, [PrimaryIntObject allObjectsInRealm:realm].count);
+    XCTAssertEqual(10, [[PrimaryStringObject objectInRealm:realm forPrimaryKey:@"1"] intCol]);
+    XCTAssertEqual(20, [[PrimaryStringObject objectInRealm:realm forPrimaryKey:@"2"] intCol]);
+
+    // Every class must have a primary key to be updated
+    RLMAssertThrowsWithReason([realm addOrUpdateObjects:@[[PrimaryIntObject new], [DogObject new]]],
+                              @"'DogObject' does not have a primary key and can not be updated");
+    RLMAssertThrowsWithReason([realm addOrUpdateObjects:@[@1]],
+                              @"with addOrUpdateObjects:. Only RLMObjects are supported.");
+    [realm cancelWriteTransaction];
+}
+
+static BOOL importJSON(RLMRealm *realm, NSString *className, NSString *json,
+                       RLMJSONImportOptions *options, NSError **error) {
+    NSInputStream *stream = [NSInputStream inputStreamWithData:[json dataUsingEncoding:NSUTF8StringEncoding]];
+    return [realm importObjectsOfClass:className fromJSONStream:stream options:options error:error];
+}
+
+- (void)testImportJSON {
+    RLMRealm *realm = [self realmWithTestPath];
+    NSError *error;
+
+    // Newline-delimited objects, split across several transactions
+    RLMJSONImportOptions *options = [RLMJSONImportOptions new];
+    options.objectsPerTransaction = 2;
+    XCTAssertTrue(importJSON(realm, @"PrimaryStringObject",
+                             @"{\"stringCol\": \"a\", \"intCol\": 1}\n"
+                             @"{\"stringCol\": \"b\\u00e9\\ud83d\\ude00\", \"intCol\": -2}\n"
+                             @"{\"intCol\": 3, \"stringCol\": \"c\"}\n",
+                             options, &error));
+    XCTAssertNil(error);
+    XCTAssertFalse(realm.inWriteTransaction);
+    XCTAssertEqual(3U, [PrimaryStringObject allObjectsInRealm:realm].count);
+    XCTAssertEqual(-2, [PrimaryStringObject objectInRealm:realm forPrimaryKey:@"b\u00e9\U0001F600"].intCol);
+
+    // A top-level array, within an existing write transaction
+    [realm beginWriteTransaction];
+    XCTAssertTrue(importJSON(realm, @"AllTypesObject",
+                             @"[{\"boolCol\": true, \"intCol\": 1, \"floatCol\": 1.5, \"doubleCol\": 2.5e2,"
+                             @"  \"stringCol\": \"str\", \"binaryCol\": \"AAEC\", \"dateCol\": 10.5,"
+                             @"  \"cBoolCol\": false, \"longCol\": 9007199254740993,"
+                             @"  \"decimalCol\": \"123.456\", \"objectIdCol\": \"60425fff91d7a195d5ddac1b\","
+                             @"  \"uuidCol\": \"137DECC8-B300-4954-A233-F89909F4FD89\","
+                             @"  \"objectCol\": {\"stringCol\": \"linked\"}, \"anyCol\": \"a\"}]",
+                             nil, &error));
+    XCTAssertTrue(realm.inWriteTransaction);
+    AllTypesObject *obj = [AllTypesObject allObjectsInRealm:realm].firstObject;
+    XCTAssertTrue(obj.boolCol);
+    XCTAssertEqual(1.5f, obj.floatCol);
+    XCTAssertEqual(250.0, obj.doubleCol);
+    XCTAssertEqualObjects([NSData dataWithBytes:"\0\1\2" length:3], obj.binaryCol);
+    XCTAssertEqualObjects([NSDate dateWithTimeIntervalSince1970:10.5], obj.dateCol);
+    XCTAssertEqual(9007199254740993LL, obj.longCol);
+    XCTAssertEqualObjects([[RLMDecimal128 alloc] initWithString:@"123.456" error:nil], obj.decimalCol);
+    XCTAssertEqualObjects(@"60425fff91d7a195d5ddac1b", obj.objectIdCol.stringValue);
+    XCTAssertEqualObjects(@"137DECC8-B300-4954-A233-F89909F4FD89", obj.uuidCol.UUIDString);
+    XCTAssertEqualObjects(@"linked", obj.objectCol.stringCol);
+    XCTAssertEqualObjects(@"a", obj.anyCol);
+    [realm cancelWriteTransaction];
+
+    // Duplicate primary keys are an error unless updating
+    XCTAssertFalse(importJSON(realm, @"PrimaryStringObject", @"{\"stringCol\": \"a\", \"intCol\": 5}", nil, &error));
+    XCTAssertEqual(error.code, RLMErrorInvalidInput);
+    XCTAssertTrue([error.localizedDescription containsString:@"existing primary key value"]);
+    options.updateExisting = YES;
+    XCTAssertTrue(importJSON(realm, @"PrimaryStringObject", @"{\"stringCol\": \"a\", \"intCol\": 5}", options, &error));
+    XCTAssertEqual(5, [PrimaryStringObject objectInRealm:realm forPrimaryKey:@"a"].intCol);
+    XCTAssertEqual(3U, [PrimaryStringObject allObjectsInRealm:realm].count);
+
+    // Unknown keys are rejected unless ignored
+    XCTAssertFalse(importJSON(realm, @"DogObject", @"{\"age\": 4, \"owner\": {\"a\": [1]}}", nil, &error));
+    XCTAssertTrue([error.localizedDescription containsString:@"Unknown property 'owner'"]);
+    options = [RLMJSONImportOptions new];
+    options.ignoreUnknownKeys = YES;
+    XCTAssertTrue(importJSON(realm, @"DogObject", @"{\"age\": 4, \"owner\": {\"a\": [1]}}", options, &error));
+    XCTAssertEqual(4, [DogObject allObjectsInRealm:realm].firstObject.age);
+
+    // Objects in transactions committed before an error remain
+    options = [RLMJSONImportOptions new];
+    options.objectsPerTransaction = 1;
+    XCTAssertFalse(importJSON(realm, @"DogObject", @"{\"age\": 1}\n{\"age\": \"two\"}\n{\"age\": 3}", options, &error));
+    XCTAssertTrue([error.localizedDescription containsString:@"Failed to import object 1"]);
+    XCTAssertFalse(realm.inWriteTransaction);
+    XCTAssertEqual(2U, [DogObject allObjectsInRealm:realm].count);
+
+    XCTAssertFalse(importJSON(realm, @"DogObject", @"{\"age\": null}", nil, &error));
+    XCTAssertTrue([error.localizedDescription containsString:@"Invalid null value for non-optional property 'age'"]);
+    XCTAssertFalse(importJSON(realm, @"DogObject", @"[{\"age\": 1}", nil, &error));
+    XCTAssertTrue([error.localizedDescription containsString:@"end of input"]);
+    XCTAssertEqual(2U, [DogObject allObjectsInRealm:realm].count);
+
+    RLMAssertThrowsWithReason(importJSON(realm, @"NotARealClass", @"{}", nil, nil),
+                              @"Object type 'NotARealClass' is not managed by the Realm");
+}
+
+- (void)testImportJSONErrorInWriteTransaction {
+    RLMRealm *realm = [self realmWithTestPath];
+    NSError *error;
+
+    // Objects before the invalid one remain in the caller's transaction, but
+    // the invalid object is not created
+    [realm beginWriteTransaction];
+    XCTAssertFalse(importJSON(realm, @"DogObject", @"{\"dogName\": \"a\", \"age\": 1}\n{\"dogName\": \"b\"}", nil, &error));
+    XCTAssertTrue([error.localizedDescription containsString:@"Missing value for property 'DogObject.age'"]);
+    XCTAssertTrue(realm.inWriteTransaction);
+    XCTAssertEqual(1U, [DogObject allObjectsInRealm:realm].count);
+
+    // Nested values are validated before the parent object is created
+    XCTAssertFalse(importJSON(realm, @"OwnerObject",
+                              @"{\"name\": \"owner\", \"dog\": {\"dogName\": \"c\", \"age\": \"old\"}}", nil, &error));
+    XCTAssertTrue([error.localizedDescription containsString:@"age"]);
+    XCTAssertEqual(0U, [OwnerObject allObjectsInRealm:realm].count);
+    XCTAssertFalse(importJSON(realm, @"OwnerObject",
+                              @"{\"name\": \"owner\", \"dog\": {\"dogName\": \"c\"}}", nil, &error));
+    XCTAssertTrue([error.localizedDescription containsString:@"Missing value for property 'DogObject.age'"]);
+    XCTAssertEqual(0U, [OwnerObject allObjectsInRealm:realm].count);
+    XCTAssertEqual(1U, [DogObject allObjectsInRealm:realm].count);
+    [realm cancelWriteTransaction];
+
+    XCTAssertFalse(importJSON(realm, @"AllTypesObject", @"{\"decimalCol\": \"not a number\"}", nil, &error));
+    XCTAssertTrue([error.localizedDescription containsString:@"Invalid Decimal128 'not a number' for property 'decimalCol'"]);
+    XCTAssertEqual(0U, [AllTypesObject allObjectsInRealm:realm].count);
+
+    // Embedded NUL characters are preserved in both scalar and nested values
+    XCTAssertTrue(importJSON(realm, @"OwnerObject",
+                             @"{\"name\": \"a\\u0000b\", \"dog\": {\"dogName\": \"c\\u0000d\", \"age\": 2}}", nil, &error));
+    OwnerObject *owner = [OwnerObject allObjectsInRealm:realm].firstObject;
+    XCTAssertEqual(owner.name.length, 3U);
+    XCTAssertEqual(owner.dog.dogName.length, 3U);
+    XCTAssertEqual([owner.dog.dogName characterAtIndex:2], 'd');
+}
+
 #pragma mark - Transactions
 
 - (void)testRealmTransactionBlock {
@@ -2242,6 +2465,56 @@
     }];
 }
 
+- (void)testOpeningRealmsConcurrently {
+    // Half of the threads open a shared file and the others open a file of
+    // their own, so that opens of different files overlap with each other and
+    // with opens of the same file
+    NSURL *sharedURL = RLMTestRealmURL();
+    dispatch_apply(8, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        @autoreleasepool {
+            RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+            config.objectClasses = @[IntObject.class, StringObject.class];
+            if (i % 2) {
+                config.fileURL = sharedURL;
+            }
+            else {
+                config.inMemoryIdentifier = @(i).stringValue;
+            }
+            NSError *error;
+            RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:&error];
+            XCTAssertNil(error);
+            [realm transactionWithBlock:^{
+                [IntObject createInRealm:realm withValue:@[@(i)]];
+            }];
+        }
+    });
+
+    RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+    config.objectClasses = @[IntObject.class, StringObject.class];
+    config.fileURL = sharedURL;
+    XCTAssertEqual(4U, [IntObject allObjectsInRealm:[RLMRealm realmWithConfiguration:config error:nil]].count);
+}
+
+- (void)testOpeningDifferentRealmsConcurrentlyWithSharedSchema {
+    // Every open uses the same schema object, whose object store schema has
+    // not been computed yet, so the opens race to compute it
+    RLMSchema *schema = [RLMSchema schemaWithObjectClasses:@[IntObject.class, StringObject.class]];
+    dispatch_apply(8, DISPATCH_APPLY_AUTO, ^(size_t i) {
+        @autoreleasepool {
+            RLMRealmConfiguration *config = [RLMRealmConfiguration new];
+            [config setCustomSchemaWithoutCopying:schema];
+            config.fileURL = [NSURL fileURLWithPath:RLMRealmPathForFile([NSString stringWithFormat:@"concurrent-%zu.realm", i])];
+            NSError *error;
+            RLMRealm *realm = [RLMRealm realmWithConfiguration:config error:&error];
+            XCTAssertNil(error);
+            [realm transactionWithBlock:^{
+                [IntObject createInRealm:realm withValue:@[@(i)]];
+            }];
+            XCTAssertEqual(1U, [IntObject allObjectsInRealm:realm].count);
+        }
+    });
+}
+
 #pragma mark - In-memory Realms
 
 - (void)testInMemoryRealm {
@@ -3030,6 +3303,108 @@
     XCTAssertTrue([logs containsString:@"TEST: IMPORTANT INFO 0"]); // Detail
     XCTAssertFalse([logs containsString:@"IMPORTANT TRACE"]); // Trace
 }
+
+- (void)testAsyncLoggerRejectsTooLargeBufferCapacity {
+    RLMAssertThrowsWithReasonMatching([[RLMLogger alloc] initWithLevel:RLMLogLevelInfo
+                                                        bufferCapacity:NSUIntegerMax
+                                                           logFunction:^(RLMLogLevel, NSString *) {}],
+                                      @"Invalid buffer capacity");
+    // Representable capacities which are too large to allocate are also rejected
+    RLMAssertThrowsWithReason([[RLMLogger alloc] initWithLevel:RLMLogLevelInfo
+                                                bufferCapacity:NSUIntegerMax / 4
+                                                   logFunction:^(RLMLogLevel, NSString *) {}],
+                              @"must be at most 1048576");
+    XCTAssertNotNil([[RLMLogger alloc] initWithLevel:RLMLogLevelInfo
+                                      bufferCapacity:1 << 20
+                                         logFunction:^(RLMLogLevel, NSString *) {}]);
+}
+
+- (void)testAsyncLogger {
+    NSMutableArray<NSString *> *messages = [NSMutableArray new];
+    __block NSThread *thread;
+    dispatch_semaphore_t entered = dispatch_semaphore_create(0);
+    dispatch_semaphore_t gate = dispatch_semaphore_create(0);
+    RLMLogger *logger = [[RLMLogger alloc] initWithLevel:RLMLogLevelInfo
+                                          bufferCapacity:3
+                                             logFunction:^(RLMLogLevel, NSString *message) {
+        thread = NSThread.currentThread;
+        [messages addObject:message];
+        if ([message isEqualToString:@"first"]) {
+            dispatch_semaphore_signal(entered);
+            dispatch_semaphore_wait(gate, DISPATCH_TIME_FOREVER);
+        }
+    }];
+
+    // Block the logger's thread inside the log function so that the buffer
+    // fills up. A capacity of 3 is rounded up to 4.
+    [logger logLevel:RLMLogLevelInfo message:@"first"];
+    dispatch_semaphore_wait(entered, DISPATCH_TIME_FOREVER);
+    for (int i = 0; i < 7; ++i) {
+        [logger logLevel:RLMLogLevelInfo message:@(i).stringValue];
+    }
+    [logger logLevel:RLMLogLevelDebug message:@"filtered"];
+    XCTAssertEqual(logger.droppedMessageCount, 3U);
+
+    dispatch_semaphore_signal(gate);
+    [logger flush];
+    XCTAssertNotEqual(thread, NSThread.currentThread);
+    XCTAssertEqualObjects(messages, (@[@"first", @"0", @"1", @"2", @"3",
+                                       @"3 log messages were dropped because the log buffer was full."]));
+
+    [messages removeAllObjects];
+    [logger logLevel:RLMLogLevelError message:@"after"];
+    [logger flush];
+    XCTAssertEqualObjects(messages, @[@"after"]);
+    XCTAssertEqual(logger.droppedMessageCount, 3U);
+
+    // Synchronous loggers report no drops and flushing does nothing
+    RLMLogger *syncLogger = [[RLMLogger alloc] initWithLevel:RLMLogLevelInfo logFunction:^(RLMLogLevel, NSString *) {}];
+    XCTAssertEqual(syncLogger.droppedMessageCount, 0U);
+    XCTAssertNoThrow([syncLogger flush]);
+}
+
+- (void)testAsyncLoggerAsDefaultLogger {
+    NSMutableString *logs = [NSMutableString new];
+    RLMLogger *logger = [[RLMLogger alloc] initWithLevel:RLMLogLevelDetail
+                                          bufferCapacity:1024
+                                             logFunction:^(RLMLogLevel level, NSString *message) {
+        [logs appendFormat:@" %lu %@", level, message];
+    }];
+    RLMLogger.defaultLogger = logger;
+    @autoreleasepool { [RLMRealm defaultRealm]; }
+    [logger flush];
+    XCTAssertTrue([logs containsString:@"5 DB:"]); // Detail
+    XCTAssertFalse([logs containsString:@"7 DB:"]); // Trace
+}
+
+- (void)testLogCategoryLevels {
+    __block NSMutableString *logs = [[NSMutableString alloc] init];
+    RLMLogger *logger = [[RLMLogger alloc] initWithLevel:RLMLogLevelOff logFunction:^(RLMLogLevel level, NSString *message) {
+        [logs appendFormat:@" %lu %@", level, message];
+    }];
+    RLMLogger.defaultLogger = logger;
+
+    [logger setLevel:RLMLogLevelDetail forCategory:@"Realm.Storage"];
+    XCTAssertEqual([logger levelForCategory:@"Realm.Storage"], RLMLogLevelDetail);
+    XCTAssertEqual([logger levelForCategory:@"Realm.Storage.Transaction"], RLMLogLevelDetail);
+    XCTAssertEqual([logger levelForCategory:@"Realm.Sync"], RLMLogLevelOff);
+
+    @autoreleasepool { [RLMRealm defaultRealm]; }
+    XCTAssertTrue([logs containsString:@"5 DB:"]); // Detail
+    XCTAssertFalse([logs containsString:@"7 DB:"]); // Trace
+
+    // Setting the overall level resets the subcategories
+    logger.level = RLMLogLevelOff;
+    XCTAssertEqual([logger levelForCategory:@"Realm.Storage"], RLMLogLevelOff);
+    [logs setString:@""];
+    @autoreleasepool { [RLMRealm defaultRealm]; }
+    XCTAssertEqual(logs.length, 0U);
+
+    RLMAssertThrowsWithReason([logger setLevel:RLMLogLevelInfo forCategory:@"Invalid"],
+                              @"Invalid log category 'Invalid'.");
+    RLMAssertThrowsWithReason([logger levelForCategory:@"Invalid"],
+                              @"Invalid log category 'Invalid'.");
+}
 @end
 
 @interface RLMMetricsTests : RLMTestCase
@@ -226,6 +226,137 @@
                                       @"write transaction");
 }
 
+- (void)testReadColumn {
+    RLMRealm *realm = self.realmWithTestPath;
+
+    NSDate *date = [NSDate dateWithTimeIntervalSinceReferenceDate:1000.5];
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 10; ++i) {
+        [AggregateObject createInRealm:realm withValue:@[@(i), @(i * 1.5f), @(i * 2.5), @(i % 2),
+                                                         [date dateByAddingTimeInterval:i]]];
+    }
+    [AllOptionalTypes createInRealm:realm withValue:@{@"intObj": @1, @"doubleObj": @2.5, @"string": @"a"}];
+    [AllOptionalTypes createInRealm:realm withValue:@{}];
+    [realm commitWriteTransaction];
+
+    RLMResults *results = [AggregateObject allObjectsInRealm:realm];
+    int64_t ints[10];
+    double doubles[10];
+    float floats[10];
+    bool bools[10];
+    NSTimeInterval dates[10];
+    [results readInt64Column:@"intCol" into:ints range:NSMakeRange(0, 10)];
+    [results readDoubleColumn:@"doubleCol" into:doubles range:NSMakeRange(0, 10)];
+    [results readFloatColumn:@"floatCol" into:floats range:NSMakeRange(0, 10)];
+    [results readBoolColumn:@"boolCol" into:bools range:NSMakeRange(0, 10)];
+    [results readTimestampColumn:@"dateCol" into:dates range:NSMakeRange(0, 10)];
+    for (int i = 0; i < 10; ++i) {
+        XCTAssertEqual(ints[i], i);
+        XCTAssertEqual(doubles[i], i * 2.5);
+        XCTAssertEqual(floats[i], i * 1.5f);
+        XCTAssertEqual(bools[i], (bool)(i % 2));
+        XCTAssertEqual(dates[i], 1000.5 + i);
+    }
+
+    RLMResults *filtered = [AggregateObject objectsInRealm:realm where:@"intCol >= 5"];
+    [filtered readInt64Column:@"intCol" into:ints range:NSMakeRange(1, 3)];
+    XCTAssertEqual(ints[0], 6);
+    XCTAssertEqual(ints[1], 7);
+    XCTAssertEqual(ints[2], 8);
+
+    RLMResults *optionals = [AllOptionalTypes allObjectsInRealm:realm];
+    NSString *strings[2];
+    [optionals readInt64Column:@"intObj" into:ints range:NSMakeRange(0, 2)];
+    [optionals readDoubleColumn:@"doubleObj" into:doubles range:NSMakeRange(0, 2)];
+    [optionals readStringColumn:@"string" into:strings range:NSMakeRange(0, 2)];
+    XCTAssertEqual(ints[0], 1);
+    XCTAssertEqual(ints[1], 0);
+    XCTAssertEqual(doubles[0], 2.5);
+    XCTAssertTrue(isnan(doubles[1]));
+    XCTAssertEqualObjects(strings[0], @"a");
+    XCTAssertNil(strings[1]);
+
+    RLMAssertThrowsWithReason([results readInt64Column:@"intCol" into:ints range:NSMakeRange(5, 6)],
+                              @"Range {5, 6} is out of bounds (must be within 0 to 10).");
+    RLMAssertThrowsWithReason([results readInt64Column:@"doubleCol" into:ints range:NSMakeRange(0, 1)],
+                              @"Property 'doubleCol' on 'AggregateObject' is of type 'double' and cannot be read as 'int'.");
+    RLMAssertThrowsWithReasonMatching([results readInt64Column:@"invalid" into:ints range:NSMakeRange(0, 1)],
+                                      @"invalid");
+}
+
+- (void)testAggregateProperties {
+    RLMRealm *realm = self.realmWithTestPath;
+
+    [realm beginWriteTransaction];
+    for (int i = 0; i < 2000; ++i) {
+        [AggregateObject createInRealm:realm withValue:@[@(i), @(i * 1.5f), @(i * 2.5), @(i % 2), NSDate.date]];
+    }
+    [AllOptionalTypes createInRealm:realm withValue:@{@"intObj": @1, @"doubleObj": @2.5}];
+    [AllOptionalTypes createInRealm:realm withValue:@{@"intObj": @5}];
+    [AllOptionalTypes createInRealm:realm withValue:@{}];
+    [realm commitWriteTransaction];
+
+    RLMResults *results = [AggregateObject objectsInRealm:realm where:@"boolCol == YES"];
+    NSArray *properties = @[@"intCol", @"floatCol", @"doubleCol"];
+    RLMAggregateResult aggregates[3];
+    [results aggregateProperties:properties into:aggregates];
+    for (int i = 0; i < 3; ++i) {
+        XCTAssertEqual(aggregates[i].count, 1000U);
+        XCTAssertEqual(aggregates[i].min, [[results minOfProperty:properties[i]] doubleValue]);
+        XCTAssertEqual(aggregates[i].max, [[results maxOfProperty:properties[i]] doubleValue]);
+        XCTAssertEqual(aggregates[i].sum, [[results sumOfProperty:properties[i]] doubleValue]);
+        XCTAssertEqualWithAccuracy(aggregates[i].average, [[results averageOfProperty:properties[i]] doubleValue], 1e-9);
+    }
+
+    // Null values are excluded
+    RLMResults *optionals = [AllOptionalTypes allObjectsInRealm:realm];
+    [optionals aggregateProperties:@[@"intObj", @"doubleObj", @"floatObj"] into:aggregates];
+    XCTAssertEqual(aggregates[0].count, 2U);
+    XCTAssertEqual(aggregates[0].min, 1);
+    XCTAssertEqual(aggregates[0].max, 5);
+    XCTAssertEqual(aggregates[0].sum, 6);
+    XCTAssertEqual(aggregates[0].average, 3);
+    XCTAssertEqual(aggregates[1].count, 1U);
+    XCTAssertEqual(aggregates[1].average, 2.5);
+    XCTAssertEqual(aggregates[2].count, 0U);
+    XCTAssertTrue(isnan(aggregates[2].min));
+    XCTAssertTrue(isnan(aggregates[2].max));
+    XCTAssertEqual(aggregates[2].sum, 0);
+    XCTAssertTrue(isnan(aggregates[2].average));
+
+    // Stored NaN values are counted rather than treated as null
+    [realm beginWriteTransaction];
+    [AllOptionalTypes createInRealm:realm withValue:@{@"doubleObj": @(NAN), @"floatObj": @(NAN)}];
+    [realm commitWriteTransaction];
+    [optionals aggregateProperties:@[@"doubleObj", @"floatObj"] into:aggregates];
+    XCTAssertEqual(aggregates[0].count, 2U);
+    XCTAssertEqual(aggregates[0].min, 2.5);
+    XCTAssertEqual(aggregates[0].max, 2.5);
+    XCTAssertTrue(isnan(aggregates[0].sum));
+    XCTAssertTrue(isnan(aggregates[0].average));
+    XCTAssertEqual(aggregates[1].count, 1U);
+    XCTAssertTrue(isnan(aggregates[1].min));
+    XCTAssertTrue(isnan(aggregates[1].sum));
+
+    [[AggregateObject objectsInRealm:realm where:@"intCol < 0"] aggregateProperties:@[@"intCol"] into:aggregates];
+    XCTAssertEqual(aggregates[0].count, 0U);
+    XCTAssertTrue(isnan(aggregates[0].average));
+
+    RLMAssertThrowsWithReason([results aggregateProperties:@[@"dateCol"] into:aggregates],
+                              @"Property 'dateCol' on 'AggregateObject' is of type 'date' and cannot be aggregated");
+    RLMAssertThrowsWithReasonMatching([results aggregateProperties:@[@"invalid"] into:aggregates], @"invalid");
+
+    // Linking objects on an unmanaged object are detached and always empty
+    RLMLinkingObjects *detached = [PersonObject new].parents;
+    aggregates[0].count = 5;
+    [detached aggregateProperties:@[@"age"] into:aggregates];
+    XCTAssertEqual(aggregates[0].count, 0U);
+    XCTAssertTrue(isnan(aggregates[0].min));
+    XCTAssertTrue(isnan(aggregates[0].max));
+    XCTAssertEqual(aggregates[0].sum, 0);
+    XCTAssertTrue(isnan(aggregates[0].average));
+}
+
 - (void)testObjectAggregate
 {
     RLMRealm *realm = [RLMRealm defaultRealm];
@@ -521,6 +652,112 @@
     XCTAssertTrue([description rangeOfString:@"912 objects skipped"].location != NSNotFound);
 }
 
+static NSString *writeDescription(RLMResults *results, RLMDescriptionOptions *options) {
+    FILE *file = tmpfile();
+    NSError *error;
+    BOOL success = [results writeDescriptionToFileDescriptor:fileno(file) options:options error:&error];
+    NSCAssert(success && !error, @"%@", error);
+    NSMutableData *data = [NSMutableData dataWithLength:(NSUInteger)ftell(file)];
+    rewind(file);
+    fread(data.mutableBytes, 1, data.length, file);
+    fclose(file);
+    return [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+}
+
+- (void)testWriteDescription {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    for (NSInteger i = 0; i < 150; ++i) {
+        [EmployeeObject createInRealm:realm withValue:@{@"name": @"Mary", @"age": @(i), @"hired": @YES}];
+    }
+    [CompanyObject createInRealm:realm withValue:@{@"name": @"Realm \"Inc\"",
+                                                  @"employees": [EmployeeObject allObjectsInRealm:realm],
+                                                  @"employeeDict": @{@"a": [EmployeeObject allObjectsInRealm:realm].firstObject}}];
+    [realm commitWriteTransaction];
+
+    RLMResults *employees = [EmployeeObject allObjectsInRealm:realm];
+    NSString *description = writeDescription(employees, nil);
+    XCTAssertTrue([description hasPrefix:@"RLMResults<EmployeeObject> (\n\t[0] EmployeeObject {\n\t\tname = Mary;\n\t\tage = 0;\n\t\thired = 1;\n\t},\n"]);
+    XCTAssertTrue([description hasSuffix:@"\t[149] EmployeeObject {\n\t\tname = Mary;\n\t\tage = 149;\n\t\thired = 1;\n\t}\n)\n"]);
+
+    RLMDescriptionOptions *options = [RLMDescriptionOptions new];
+    options.maxObjects = 2;
+    description = writeDescription(employees, options);
+    XCTAssertTrue([description hasSuffix:@"\t[1] EmployeeObject {\n\t\tname = Mary;\n\t\tage = 1;\n\t\thired = 1;\n\t}\n\t... 148 objects skipped.\n)\n"]);
+
+    // Nested collections are limited separately from the top-level objects
+    options.maxNestedObjects = 3;
+    description = writeDescription([CompanyObject allObjectsInRealm:realm], options);
+    XCTAssertTrue([description rangeOfString:@"employees = RLMArray<EmployeeObject> ("].location != NSNotFound);
+    XCTAssertTrue([description rangeOfString:@"[2] EmployeeObject {"].location != NSNotFound);
+    XCTAssertTrue([description rangeOfString:@"[3] EmployeeObject {"].location == NSNotFound);
+    XCTAssertTrue([description rangeOfString:@"... 147 objects skipped."].location != NSNotFound);
+    XCTAssertTrue([description rangeOfString:@"[a]: EmployeeObject {"].location != NSNotFound);
+
+    options.maxDepth = 2;
+    description = writeDescription([CompanyObject allObjectsInRealm:realm], options);
+    XCTAssertTrue([description rangeOfString:@"employees = <Maximum depth exceeded>;"].location != NSNotFound);
+
+    // JSON output is one object per line which can be parsed individually
+    options = [RLMDescriptionOptions new];
+    options.json = YES;
+    options.maxObjects = 10;
+    description = writeDescription(employees, options);
+    NSArray *lines = [[description stringByTrimmingCharactersInSet:NSCharacterSet.newlineCharacterSet]
+                      componentsSeparatedByString:@"\n"];
+    XCTAssertEqual(lines.count, 10U);
+    NSDictionary *json = [NSJSONSerialization JSONObjectWithData:[lines[3] dataUsingEncoding:NSUTF8StringEncoding]
+                                                         options:0 error:nil];
+    XCTAssertEqualObjects(json, (@{@"name": @"Mary", @"age": @3, @"hired": @YES}));
+
+    description = writeDescription([CompanyObject allObjectsInRealm:realm], options);
+    json = [NSJSONSerialization JSONObjectWithData:[description dataUsingEncoding:NSUTF8StringEncoding]
+                                           options:0 error:nil];
+    XCTAssertEqualObjects(json[@"name"], @"Realm \"Inc\"");
+    XCTAssertEqual([json[@"employees"] count], 150U);
+    XCTAssertEqualObjects(json[@"employeeDict"][@"a"][@"age"], @0);
+
+    // Nested collections in JSON are only truncated if a limit is set
+    options.maxNestedObjects = 100;
+    description = writeDescription([CompanyObject allObjectsInRealm:realm], options);
+    json = [NSJSONSerialization JSONObjectWithData:[description dataUsingEncoding:NSUTF8StringEncoding]
+                                           options:0 error:nil];
+    XCTAssertEqual([json[@"employees"] count], 100U);
+
+    // Write errors are reported rather than thrown
+    NSError *error;
+    XCTAssertFalse([employees writeDescriptionToFileDescriptor:-1 options:nil error:&error]);
+    XCTAssertEqualObjects(error.domain, NSPOSIXErrorDomain);
+    XCTAssertEqual(error.code, EBADF);
+}
+
+- (void)testWriteDescriptionToLogger {
+    RLMRealm *realm = [RLMRealm defaultRealm];
+    [realm beginWriteTransaction];
+    for (NSInteger i = 0; i < 5; ++i) {
+        [EmployeeObject createInRealm:realm withValue:@{@"name": @"Mary", @"age": @(i), @"hired": @YES}];
+    }
+    [realm commitWriteTransaction];
+
+    NSMutableArray<NSString *> *messages = [NSMutableArray new];
+    RLMLogger *logger = [[RLMLogger alloc] initWithLevel:RLMLogLevelInfo
+                                             logFunction:^(RLMLogLevel level, NSString *message) {
+        XCTAssertEqual(level, RLMLogLevelInfo);
+        [messages addObject:message];
+    }];
+
+    RLMDescriptionOptions *options = [RLMDescriptionOptions new];
+    options.json = YES;
+    [[EmployeeObject allObjectsInRealm:realm] writeDescriptionToLogger:logger level:RLMLogLevelInfo options:options];
+    XCTAssertEqual(messages.count, 5U);
+    XCTAssertEqualObjects(messages[0], @"{\"name\":\"Mary\",\"age\":0,\"hired\":true}");
+
+    // Nothing is written for levels which the logger is not logging
+    [messages removeAllObjects];
+    [[EmployeeObject allObjectsInRealm:realm] writeDescriptionToLogger:logger level:RLMLogLevelDebug options:options];
+    XCTAssertEqual(messages.count, 0U);
+}
+
 - (void)testIndexOfObject
 {
     RLMRealm *realm = [RLMRealm defaultRealm];
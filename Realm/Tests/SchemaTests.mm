@@ -180,6 +180,24 @@ RLM_COLLECTION_TYPE(NonDefaultObject);
 }
 @end
 
+@interface MissingInternedProperty : FakeObject
+@property NSString *stringCol;
+@end
+@implementation MissingInternedProperty
++ (NSArray *)internedStringProperties {
+    return @[@"missing"];
+}
+@end
+
+@interface NonStringInternedProperty : FakeObject
+@property int intCol;
+@end
+@implementation NonStringInternedProperty
++ (NSArray *)internedStringProperties {
+    return @[@"intCol"];
+}
+@end
+
 @interface RequiredLinkProperty : FakeObject
 @property BoolObject *object;
 @end
@@ -762,6 +780,13 @@ RLM_COLLECTION_TYPE(NotARealClass)
                               @"Primary key property 'primaryKey' does not exist on object 'MissingPrimaryKey'");
 }
 
+- (void)testClassWithInvalidInternedProperties {
+    RLMAssertThrowsWithReason([RLMObjectSchema schemaForObjectClass:MissingInternedProperty.class],
+                              @"Interned property 'missing' does not exist on object 'MissingInternedProperty'");
+    RLMAssertThrowsWithReason([RLMObjectSchema schemaForObjectClass:NonStringInternedProperty.class],
+                              @"Property 'intCol' cannot be interned on 'NonStringInternedProperty' because it is not a 'string' property.");
+}
+
 - (void)testClassWithUnindexableProperty {
     RLMObjectSchema *objectSchema = [RLMObjectSchema schemaForObjectClass:UnindexableProperty.class];
     RLMSchema *schema = [[RLMSchema alloc] init];
@@ -939,6 +964,28 @@ RLM_COLLECTION_TYPE(NotARealClass)
     XCTAssertEqualObjects(@"NumberDefaultsObject", [[[[NumberDefaultsObject alloc] init] objectSchema] className]);
 }
 
+- (void)testSharedSchemaReflectsClassesOnFirstUse {
+    if (self.isParent) {
+        RLMRunChildAndWait();
+        return;
+    }
+
+    RLMSchema *schema = [RLMSchema sharedSchema];
+    XCTAssertNil(RLMSchema.partialPrivateSharedSchema[@"IntObject"]);
+    XCTAssertNil(RLMSchema.partialPrivateSharedSchema[@"StringObject"]);
+
+    RLMObjectSchema *objectSchema = schema[@"IntObject"];
+    XCTAssertEqualObjects(objectSchema.className, @"IntObject");
+    XCTAssertEqual(RLMSchema.partialPrivateSharedSchema[@"IntObject"], objectSchema);
+    XCTAssertNil(RLMSchema.partialPrivateSharedSchema[@"StringObject"]);
+
+    // Requesting the full schema reflects everything else
+    XCTAssertNotNil([schema.objectSchema filteredArrayUsingPredicate:
+                     [NSPredicate predicateWithFormat:@"className = 'StringObject'"]].firstObject);
+    XCTAssertNotNil(RLMSchema.partialPrivateSharedSchema[@"StringObject"]);
+    XCTAssertEqual(schema[@"IntObject"], objectSchema);
+}
+
 - (void)testCreateUnmanagedObjectWithUninitializedSchema {
     if (self.isParent) {
         RLMRunChildAndWait();
@@ -490,3 +490,394 @@ extension AnyBSON: ExpressibleByArrayLiteral {
 extension AnyBSON: Equatable {}
 
 extension AnyBSON: Hashable {}
+
+// MARK: - Decoding
+
+/// A lazily converted view of a BSON document.
+///
+/// - SeeAlso: `RLMBSONDocumentView`
+public typealias BSONDocumentView = RLMBSONDocumentView
+
+extension BSONDocumentView {
+    /// Creates a view of a copy of the given document.
+    public convenience init(_ document: Document) {
+        self.init(dictionary: ObjectiveCSupport.convert(document))
+    }
+}
+
+/// A lazily converted view of a BSON array.
+///
+/// - SeeAlso: `RLMBSONArrayView`
+public typealias BSONArrayView = RLMBSONArrayView
+
+/**
+ An object which decodes `Decodable` values directly from BSON documents.
+
+ Rather than first converting documents to `Document` dictionaries, values are
+ read from the underlying BSON as each field is decoded, and fields which are
+ not needed by the type being decoded are never converted. Any `Decodable`
+ type can be decoded, including Realm objects which conform to `Decodable`.
+
+ `Date`, `Data`, `UUID`, `ObjectId`, `Decimal128` and `AnyBSON` values are read
+ from the corresponding BSON types. Integers may be read from BSON int32,
+ int64 or double values as long as the value fits exactly in the integer type.
+ */
+public struct BSONDecoder: Sendable {
+    /// Creates a new decoder.
+    public init() {}
+
+    /// Decodes a value of the given type from a BSON document.
+    public func decode<T: Decodable>(_ type: T.Type, from document: BSONDocumentView) throws -> T {
+        try _BSONDecoder(slot: .document(document), codingPath: []).decodeValue(T.self)
+    }
+
+    /// Decodes an array of values of the given type from a BSON array.
+    public func decode<T: Decodable>(_ type: T.Type, from array: BSONArrayView) throws -> [T] {
+        try (0..<array.count).map { index in
+            let key = _BSONKey(index: index)
+            return try _BSONDecoder(slot: .value(array, index), codingPath: [key]).decodeValue(T.self)
+        }
+    }
+}
+
+private struct _BSONKey: CodingKey {
+    var stringValue: String
+    var intValue: Int?
+
+    init(stringValue: String) {
+        self.stringValue = stringValue
+    }
+
+    init(intValue: Int) {
+        self.stringValue = String(intValue)
+        self.intValue = intValue
+    }
+
+    init(index: Int) {
+        self.init(intValue: index)
+    }
+}
+
+/// The location of a single BSON value which has not yet been converted.
+private enum _BSONSlot {
+    case document(BSONDocumentView)
+    case value(RLMBSONIndexedValues, Int)
+
+    var type: RLMBSONType {
+        switch self {
+        case .document: return .document
+        case let .value(values, index): return values.type(at: index)
+        }
+    }
+
+    var object: RLMBSON? {
+        switch self {
+        case let .document(document): return document.dictionaryValue as NSDictionary
+        case let .value(values, index): return values.object(at: index)
+        }
+    }
+
+    var document: BSONDocumentView? {
+        switch self {
+        case let .document(document): return document
+        case let .value(values, index): return values.document(at: index)
+        }
+    }
+
+    var array: BSONArrayView? {
+        switch self {
+        case .document: return nil
+        case let .value(values, index): return values.array(at: index)
+        }
+    }
+}
+
+private struct _BSONDecoder: Decoder, SingleValueDecodingContainer {
+    let slot: _BSONSlot
+    let type: RLMBSONType
+    let codingPath: [CodingKey]
+    var userInfo: [CodingUserInfoKey: Any] { [:] }
+
+    init(slot: _BSONSlot, codingPath: [CodingKey]) {
+        self.slot = slot
+        self.type = slot.type
+        self.codingPath = codingPath
+    }
+
+    func container<Key: CodingKey>(keyedBy type: Key.Type) throws -> KeyedDecodingContainer<Key> {
+        guard let document = slot.document else {
+            throw typeMismatch([String: Any].self)
+        }
+        return KeyedDecodingContainer(_BSONKeyedContainer(document: document, codingPath: codingPath))
+    }
+
+    func unkeyedContainer() throws -> UnkeyedDecodingContainer {
+        guard let array = slot.array else {
+            throw typeMismatch([Any].self)
+        }
+        return _BSONUnkeyedContainer(array: array, codingPath: codingPath)
+    }
+
+    func singleValueContainer() throws -> SingleValueDecodingContainer {
+        self
+    }
+
+    private func typeMismatch(_ type: Any.Type) -> DecodingError {
+        .typeMismatch(type, .init(codingPath: codingPath,
+                                  debugDescription: "Expected to decode \(type) but found a BSON value of a different type instead."))
+    }
+
+    private func dataCorrupted(_ description: String) -> DecodingError {
+        .dataCorrupted(.init(codingPath: codingPath, debugDescription: description))
+    }
+
+    /// The location of a scalar value of one of the given BSON types, which
+    /// can be read with the typed accessors without boxing it.
+    private func scalar(_ type: Any.Type, _ bsonTypes: RLMBSONType...) throws -> (RLMBSONIndexedValues, Int) {
+        guard case let .value(values, index) = slot, bsonTypes.contains(self.type) else {
+            throw typeMismatch(type)
+        }
+        return (values, index)
+    }
+
+    func decodeNil() -> Bool {
+        type == .null
+    }
+
+    func decode(_ type: Bool.Type) throws -> Bool {
+        let (values, index) = try scalar(type, .bool)
+        return values.bool(at: index)
+    }
+
+    func decode(_ type: String.Type) throws -> String {
+        let (values, index) = try scalar(type, .string)
+        return values.string(at: index)
+    }
+
+    private func decodeInteger<T: FixedWidthInteger>(_ type: T.Type) throws -> T {
+        let (values, index) = try scalar(type, .int32, .int64, .double)
+        if self.type == .double {
+            let value = values.double(at: index)
+            guard let result = T(exactly: value) else {
+                throw dataCorrupted("BSON number \(value) does not fit in \(type).")
+            }
+            return result
+        }
+        let value = values.int64(at: index)
+        guard let result = T(exactly: value) else {
+            throw dataCorrupted("BSON number \(value) does not fit in \(type).")
+        }
+        return result
+    }
+
+    private func decodeFloat<T: BinaryFloatingPoint>(_ type: T.Type) throws -> T {
+        let (values, index) = try scalar(type, .double, .int32, .int64)
+        if self.type == .double {
+            return T(values.double(at: index))
+        }
+        return T(values.int64(at: index))
+    }
+
+    func decode(_ type: Double.Type) throws -> Double { try decodeFloat(type) }
+    func decode(_ type: Float.Type) throws -> Float { try decodeFloat(type) }
+    func decode(_ type: Int.Type) throws -> Int { try decodeInteger(type) }
+    func decode(_ type: Int8.Type) throws -> Int8 { try decodeInteger(type) }
+    func decode(_ type: Int16.Type) throws -> Int16 { try decodeInteger(type) }
+    func decode(_ type: Int32.Type) throws -> Int32 { try decodeInteger(type) }
+    func decode(_ type: Int64.Type) throws -> Int64 { try decodeInteger(type) }
+    func decode(_ type: UInt.Type) throws -> UInt { try decodeInteger(type) }
+    func decode(_ type: UInt8.Type) throws -> UInt8 { try decodeInteger(type) }
+    func decode(_ type: UInt16.Type) throws -> UInt16 { try decodeInteger(type) }
+    func decode(_ type: UInt32.Type) throws -> UInt32 { try decodeInteger(type) }
+    func decode(_ type: UInt64.Type) throws -> UInt64 { try decodeInteger(type) }
+
+    func decode<T: Decodable>(_ type: T.Type) throws -> T {
+        try decodeValue(type)
+    }
+
+    /// Decodes the types which have a native BSON representation directly,
+    /// rather than via their own `Decodable` implementations, which expect
+    /// the representation used by JSON.
+    func decodeValue<T: Decodable>(_ type: T.Type) throws -> T {
+        switch type {
+        case is Date.Type:
+            let (values, index) = try scalar(type, .datetime, .timestamp)
+            return Date(timeIntervalSince1970: values.timeIntervalSince1970(at: index)) as! T
+        case is Data.Type:
+            let (values, index) = try scalar(type, .binary)
+            return values.data(at: index) as! T
+        case is UUID.Type:
+            let (values, index) = try scalar(type, .UUID)
+            return values.uuid(at: index) as! T
+        case is ObjectId.Type:
+            // RLMObjectId instances are always created as the Swift subclass
+            let (values, index) = try scalar(type, .objectId)
+            return values.objectId(at: index) as! T
+        case is Decimal128.Type:
+            let (values, index) = try scalar(type, .decimal128)
+            return values.decimal128(at: index) as! T
+        case is AnyBSON.Type:
+            guard let value = slot.object.flatMap(ObjectiveCSupport.convertBson(object:)) else {
+                throw typeMismatch(type)
+            }
+            return value as! T
+        default:
+            return try T(from: self)
+        }
+    }
+}
+
+private struct _BSONKeyedContainer<Key: CodingKey>: KeyedDecodingContainerProtocol {
+    let document: BSONDocumentView
+    let codingPath: [CodingKey]
+
+    var allKeys: [Key] {
+        document.keys.compactMap(Key.init(stringValue:))
+    }
+
+    func contains(_ key: Key) -> Bool {
+        document.index(ofKey: key.stringValue) != NSNotFound
+    }
+
+    /// A decoder for the field with the given key, or `nil` if there is no
+    /// such field. The field is looked up once and then read by index.
+    private func decoderIfPresent(for key: Key) -> _BSONDecoder? {
+        let index = document.index(ofKey: key.stringValue)
+        guard index != NSNotFound else {
+            return nil
+        }
+        return _BSONDecoder(slot: .value(document, index), codingPath: codingPath + [key])
+    }
+
+    private func decoder(for key: Key) throws -> _BSONDecoder {
+        guard let decoder = decoderIfPresent(for: key) else {
+            throw DecodingError.keyNotFound(key, .init(codingPath: codingPath,
+                                                       debugDescription: "No value associated with key \(key.stringValue)."))
+        }
+        return decoder
+    }
+
+    /// Decodes an optional value with a single lookup of the key, rather than
+    /// the separate `contains`, `decodeNil` and `decode` calls made by the
+    /// default implementations.
+    private func decodeIfPresent<T>(forKey key: Key, _ decode: (_BSONDecoder) throws -> T) throws -> T? {
+        guard let decoder = decoderIfPresent(for: key), !decoder.decodeNil() else {
+            return nil
+        }
+        return try decode(decoder)
+    }
+
+    func decodeNil(forKey key: Key) throws -> Bool {
+        try decoder(for: key).decodeNil()
+    }
+
+    func decode(_ type: Bool.Type, forKey key: Key) throws -> Bool { try decoder(for: key).decode(type) }
+    func decode(_ type: String.Type, forKey key: Key) throws -> String { try decoder(for: key).decode(type) }
+    func decode(_ type: Double.Type, forKey key: Key) throws -> Double { try decoder(for: key).decode(type) }
+    func decode(_ type: Float.Type, forKey key: Key) throws -> Float { try decoder(for: key).decode(type) }
+    func decode(_ type: Int.Type, forKey key: Key) throws -> Int { try decoder(for: key).decode(type) }
+    func decode(_ type: Int8.Type, forKey key: Key) throws -> Int8 { try decoder(for: key).decode(type) }
+    func decode(_ type: Int16.Type, forKey key: Key) throws -> Int16 { try decoder(for: key).decode(type) }
+    func decode(_ type: Int32.Type, forKey key: Key) throws -> Int32 { try decoder(for: key).decode(type) }
+    func decode(_ type: Int64.Type, forKey key: Key) throws -> Int64 { try decoder(for: key).decode(type) }
+    func decode(_ type: UInt.Type, forKey key: Key) throws -> UInt { try decoder(for: key).decode(type) }
+    func decode(_ type: UInt8.Type, forKey key: Key) throws -> UInt8 { try decoder(for: key).decode(type) }
+    func decode(_ type: UInt16.Type, forKey key: Key) throws -> UInt16 { try decoder(for: key).decode(type) }
+    func decode(_ type: UInt32.Type, forKey key: Key) throws -> UInt32 { try decoder(for: key).decode(type) }
+    func decode(_ type: UInt64.Type, forKey key: Key) throws -> UInt64 { try decoder(for: key).decode(type) }
+    func decode<T: Decodable>(_ type: T.Type, forKey key: Key) throws -> T { try decoder(for: key).decodeValue(type) }
+
+    func decodeIfPresent(_ type: Bool.Type, forKey key: Key) throws -> Bool? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: String.Type, forKey key: Key) throws -> String? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: Double.Type, forKey key: Key) throws -> Double? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: Float.Type, forKey key: Key) throws -> Float? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: Int.Type, forKey key: Key) throws -> Int? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: Int8.Type, forKey key: Key) throws -> Int8? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: Int16.Type, forKey key: Key) throws -> Int16? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: Int32.Type, forKey key: Key) throws -> Int32? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: Int64.Type, forKey key: Key) throws -> Int64? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: UInt.Type, forKey key: Key) throws -> UInt? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: UInt8.Type, forKey key: Key) throws -> UInt8? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: UInt16.Type, forKey key: Key) throws -> UInt16? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: UInt32.Type, forKey key: Key) throws -> UInt32? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent(_ type: UInt64.Type, forKey key: Key) throws -> UInt64? { try decodeIfPresent(forKey: key) { try $0.decode(type) } }
+    func decodeIfPresent<T: Decodable>(_ type: T.Type, forKey key: Key) throws -> T? {
+        try decodeIfPresent(forKey: key) { try $0.decodeValue(type) }
+    }
+
+    func nestedContainer<NestedKey: CodingKey>(keyedBy type: NestedKey.Type,
+                                               forKey key: Key) throws -> KeyedDecodingContainer<NestedKey> {
+        try decoder(for: key).container(keyedBy: type)
+    }
+
+    func nestedUnkeyedContainer(forKey key: Key) throws -> UnkeyedDecodingContainer {
+        try decoder(for: key).unkeyedContainer()
+    }
+
+    func superDecoder() throws -> Decoder {
+        _BSONDecoder(slot: .document(document), codingPath: codingPath)
+    }
+
+    func superDecoder(forKey key: Key) throws -> Decoder {
+        try decoder(for: key)
+    }
+}
+
+private struct _BSONUnkeyedContainer: UnkeyedDecodingContainer {
+    let array: BSONArrayView
+    let codingPath: [CodingKey]
+    private(set) var currentIndex = 0
+
+    init(array: BSONArrayView, codingPath: [CodingKey]) {
+        self.array = array
+        self.codingPath = codingPath
+    }
+
+    var count: Int? { array.count }
+    var isAtEnd: Bool { currentIndex >= array.count }
+
+    private mutating func nextDecoder(_ type: Any.Type) throws -> _BSONDecoder {
+        guard !isAtEnd else {
+            throw DecodingError.valueNotFound(type, .init(codingPath: codingPath + [_BSONKey(index: currentIndex)],
+                                                          debugDescription: "Unkeyed container is at end."))
+        }
+        defer { currentIndex += 1 }
+        return _BSONDecoder(slot: .value(array, currentIndex), codingPath: codingPath + [_BSONKey(index: currentIndex)])
+    }
+
+    mutating func decodeNil() throws -> Bool {
+        guard !isAtEnd, array.type(at: currentIndex) == .null else {
+            return false
+        }
+        currentIndex += 1
+        return true
+    }
+
+    mutating func decode(_ type: Bool.Type) throws -> Bool { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: String.Type) throws -> String { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: Double.Type) throws -> Double { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: Float.Type) throws -> Float { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: Int.Type) throws -> Int { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: Int8.Type) throws -> Int8 { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: Int16.Type) throws -> Int16 { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: Int32.Type) throws -> Int32 { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: Int64.Type) throws -> Int64 { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: UInt.Type) throws -> UInt { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: UInt8.Type) throws -> UInt8 { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: UInt16.Type) throws -> UInt16 { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: UInt32.Type) throws -> UInt32 { try nextDecoder(type).decode(type) }
+    mutating func decode(_ type: UInt64.Type) throws -> UInt64 { try nextDecoder(type).decode(type) }
+    mutating func decode<T: Decodable>(_ type: T.Type) throws -> T { try nextDecoder(type).decodeValue(type) }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy type: NestedKey.Type) throws -> KeyedDecodingContainer<NestedKey> {
+        try nextDecoder(type).container(keyedBy: type)
+    }
+
+    mutating func nestedUnkeyedContainer() throws -> UnkeyedDecodingContainer {
+        try nextDecoder([Any].self).unkeyedContainer()
+    }
+
+    mutating func superDecoder() throws -> Decoder {
+        try nextDecoder(Any.self)
+    }
+}
@@ -131,6 +131,20 @@ extension EmbeddedObject: _RealmCollectionValueInsideOptional {
      */
     @objc open class func ignoredProperties() -> [String] { return [] }
 
+    /**
+     Override this method to specify the names of `String` properties whose
+     values should be interned.
+
+     Properties with a small number of distinct values, such as a status or a
+     country code, can be interned so that repeatedly reading the same value
+     returns the same string from a bounded per-property cache rather than
+     allocating a new one each time. Values which don't fit in the cache are
+     read normally.
+
+     - returns: An array of property names to intern.
+     */
+    @objc open class func internedStringProperties() -> [String] { return [] }
+
     /**
      Override this method to specify a map of public-private property names.
      This will set a different persisted property name on the Realm, and allows using the public name
@@ -106,6 +106,84 @@ extension Migration {
         }
     }
 
+    /**
+     Computes new property values for all the objects of a given type from their values before the migration, running
+     the block concurrently on multiple threads.
+
+     This is much faster than `enumerateObjects(ofType:_:)` for migrations which only need to compute new values for each
+     object from its old values, as no objects are created for the block and it is run on every available core. The
+     values returned by the block are written to the migrated objects in order, `batchSize` objects at a time.
+
+     The block must not access the Realm or the migration, and must be safe to call concurrently from multiple threads.
+
+     - parameter typeName:  The name of the `Object` class to transform. This class must be present in both the old and
+                            new Realm schemas.
+     - parameter batchSize: The number of objects to transform before writing the new values. Must be greater than zero.
+     - parameter block:     A block which is passed the values of an object's properties before the migration, other
+                            than links to other objects, and returns the values to set on the migrated object or `nil`
+                            to leave it unchanged.
+     */
+    public func transformObjects(ofType typeName: String, batchSize: UInt = 10_000,
+                                 _ block: @escaping @Sendable ([String: Any]) -> [String: Any]?) {
+        __transformObjects(typeName, batchSize: batchSize, block: block)
+    }
+
+    /**
+     Copies the values of a property in the old schema to a property in the new schema for every object of the given
+     type, converting them to the type of the new property.
+
+     The values are read and written directly without creating any objects. Numbers are converted to and from strings,
+     integers to and from floating point numbers when no precision is lost, bools to and from the integers 0 and 1, and
+     `ObjectId`, `Decimal128` and `UUID` values to and from their string representations.
+
+     - parameter oldName:  The name of the property in the old schema to read from.
+     - parameter newName:  The name of the property in the new schema to write to.
+     - parameter typeName: The name of the class whose property should be copied. This class must be present in both
+                           the old and new Realm schemas.
+     */
+    public func copyValues(ofProperty oldName: String, to newName: String, onType typeName: String) {
+        __copyValues(ofProperty: oldName, toProperty: newName, ofClass: typeName)
+    }
+
+    /**
+     Sets a property on every object of the given type to a value computed from the value of a property before the
+     migration.
+
+     This reads and writes the property directly without creating any objects. Values returned by the block are
+     converted to the type of the new property as by `PropertyConverter.typeConversion`.
+
+     - parameter oldName:  The name of the property in the old schema to read from. If there is no such property, or an
+                           object did not exist before the migration, the block is passed `nil`.
+     - parameter typeName: The name of the class whose property should be transformed. This class must be present in
+                           both the old and new Realm schemas.
+     - parameter newName:  The name of the property in the new schema to write to, or `nil` to use `oldName`.
+     - parameter block:    The block which computes the new value of the property.
+     */
+    public func transformProperty(_ oldName: String, onType typeName: String, to newName: String? = nil,
+                                  _ block: @escaping (Any?) -> Any?) {
+        __transformProperty(oldName, ofClass: typeName, toProperty: newName ?? oldName) { oldValue in
+            block(oldValue).map { $0 as AnyObject } as? RLMValue
+        }
+    }
+
+    /**
+     Sets a property on every object of the given type to a value computed from the value of a property before the
+     migration using one of the built-in converters.
+
+     Built-in converters run entirely on the values stored in the Realm without creating any objects, and so are much
+     faster than passing a block.
+
+     - parameter oldName:   The name of the property in the old schema to read from.
+     - parameter typeName:  The name of the class whose property should be transformed. This class must be present in
+                            both the old and new Realm schemas.
+     - parameter newName:   The name of the property in the new schema to write to, or `nil` to use `oldName`.
+     - parameter converter: The converter which computes the new value of the property.
+     */
+    public func transformProperty(_ oldName: String, onType typeName: String, to newName: String? = nil,
+                                  using converter: PropertyConverter) {
+        __transformProperty(oldName, ofClass: typeName, toProperty: newName ?? oldName, converter: converter)
+    }
+
     /**
      Creates and returns an `Object` of type `className` in the Realm being migrated.
 
@@ -412,6 +412,46 @@ extension MongoCollection {
         }
     }
 
+    /// Finds the documents in this collection which match the provided filter,
+    /// and decodes them directly from BSON as values of the given type.
+    ///
+    /// This is much faster than decoding the result of `find(filter:options:_:)`,
+    /// as the documents are never converted to `Document`s, and fields which
+    /// are not needed by `T` are never read.
+    /// - Parameters:
+    ///   - filter: A `Document` as bson that should match the query.
+    ///   - options: `FindOptions` to use when executing the command.
+    ///   - type: The type to decode each document as.
+    ///   - completion: The decoded documents or error if one occurs
+    @preconcurrency
+    public func find<T: Decodable>(filter: Document, options: FindOptions = FindOptions(), as type: T.Type,
+                                   _ completion: @escaping @Sendable (Result<[T], Error>) -> Void) {
+        __findDocumentViewsWhere(ObjectiveCSupport.convert(filter), options: options) { view, error in
+            completion(Result {
+                guard let view else { throw error ?? Realm.Error.callFailed }
+                return try BSONDecoder().decode(type, from: view)
+            })
+        }
+    }
+
+    /// Runs an aggregation framework pipeline against this collection, and
+    /// decodes the resulting documents directly from BSON as values of the
+    /// given type.
+    /// - Parameters:
+    ///   - pipeline: A bson array made up of `Documents` containing the pipeline of aggregation operations to perform.
+    ///   - type: The type to decode each document as.
+    ///   - completion: The decoded documents or error if one occurs
+    @preconcurrency
+    public func aggregate<T: Decodable>(pipeline: [Document], as type: T.Type,
+                                        _ completion: @escaping @Sendable (Result<[T], Error>) -> Void) {
+        __aggregateDocumentViews(withPipeline: pipeline.map(ObjectiveCSupport.convert)) { view, error in
+            completion(Result {
+                guard let view else { throw error ?? Realm.Error.callFailed }
+                return try BSONDecoder().decode(type, from: view)
+            })
+        }
+    }
+
     /// Counts the number of documents in this collection matching the provided filter.
     /// - Parameters:
     ///   - filter: A `Document` as bson that should match the query.
@@ -653,6 +693,44 @@ extension MongoCollection {
             .map(ObjectiveCSupport.convert)
     }
 
+    /// Finds the documents in this collection which match the provided filter,
+    /// and decodes them directly from BSON as values of the given type.
+    ///
+    /// This is much faster than decoding the result of `find(filter:options:)`,
+    /// as the documents are never converted to `Document`s, and fields which
+    /// are not needed by `T` are never read. The documents are decoded on the
+    /// thread which receives the response rather than on the calling actor.
+    /// - Parameters:
+    ///   - filter: A `Document` as bson that should match the query.
+    ///   - options: `FindOptions` to use when executing the command.
+    ///   - type: The type to decode each document as.
+    /// - Returns: Array of the decoded documents.
+    public func find<T: Decodable>(filter: Document, options: FindOptions = .init(), as type: T.Type,
+                                   _isolation: isolated (any Actor)? = #isolation) async throws -> [T] {
+        try await withCheckedThrowingContinuation { continuation in
+            find(filter: filter, options: options, as: type) { result in
+                continuation.resume(with: result)
+            }
+        }
+    }
+
+    /// Runs an aggregation framework pipeline against this collection, and
+    /// decodes the resulting documents directly from BSON as values of the
+    /// given type. The documents are decoded on the thread which receives the
+    /// response rather than on the calling actor.
+    /// - Parameters:
+    ///   - pipeline: A bson array made up of `Documents` containing the pipeline of aggregation operations to perform.
+    ///   - type: The type to decode each document as.
+    /// - Returns: Array of the decoded documents.
+    public func aggregate<T: Decodable>(pipeline: [Document], as type: T.Type,
+                                        _isolation: isolated (any Actor)? = #isolation) async throws -> [T] {
+        try await withCheckedThrowingContinuation { continuation in
+            aggregate(pipeline: pipeline, as: type) { result in
+                continuation.resume(with: result)
+            }
+        }
+    }
+
     /// Counts the number of documents in this collection matching the provided filter.
     /// - Parameters:
     ///   - filter: A `Document` as bson that should match the query.
@@ -178,6 +178,20 @@ extension Object: _RealmCollectionValueInsideOptional {
      */
     @objc open class func indexedProperties() -> [String] { return [] }
 
+    /**
+     Override this method to specify the names of `String` properties whose
+     values should be interned.
+
+     Properties with a small number of distinct values, such as a status or a
+     country code, can be interned so that repeatedly reading the same value
+     returns the same string from a bounded per-property cache rather than
+     allocating a new one each time. Values which don't fit in the cache are
+     read normally.
+
+     - returns: An array of property names to intern.
+     */
+    @objc open class func internedStringProperties() -> [String] { return [] }
+
     /**
      Override this method to specify a map of public-private property names.
      This will set a different persisted property name on the Realm, and allows using the public name
@@ -620,6 +634,61 @@ extension Object: ThreadConfined {
     }
 }
 
+/**
+ The identity of a managed object within the Realm which manages it.
+
+ This is made up of the keys which Realm uses internally to locate the object,
+ and reading it does not read any of the object's properties or allocate any
+ memory. This makes it suitable for identity-based diffing of large numbers of
+ objects, where hashing the objects themselves would be slower.
+
+ Two objects managed by the same Realm have the same identity if and only if
+ they are the same object. Identities from different Realm files should not be
+ compared, and the identity of a deleted object may later be reused by a new
+ object of the same type.
+ */
+@frozen public struct ObjectIdentity: Hashable, Sendable {
+    /// The key of the table which stores objects of this type.
+    public let tableKey: UInt32
+    /// The key of the object within its table.
+    public let objectKey: Int64
+}
+
+extension ObjectBase {
+    /// The identity of this object within its Realm, or `nil` if the object is unmanaged.
+    public var objectIdentity: ObjectIdentity? {
+        var identity = RLMObjectIdentity()
+        guard RLMObjectBaseGetIdentity(self, &identity) else {
+            return nil
+        }
+        return ObjectIdentity(tableKey: identity.tableKey, objectKey: identity.objectKey)
+    }
+
+    /**
+     Calls the closure with the stored bytes of a `String` or `Data` property,
+     without copying the value into a `String` or `Data`.
+
+     For managed objects the buffer points directly into the Realm file. It is
+     only valid until the closure returns, and the Realm will not be
+     automatically refreshed while the closure is running. The closure must not
+     refresh the Realm, begin or commit a write transaction, or modify the
+     object. Strings are passed as UTF-8 and are not null-terminated.
+
+     - parameter propertyName: The name of a `String` or `Data` property.
+     - parameter body: A closure which is passed the bytes of the value, or
+                       `nil` if the value is `nil`.
+     - returns: The value returned by `body`.
+     */
+    public func withUnsafeBytes<Result>(for propertyName: String,
+                                        _ body: (UnsafeRawBufferPointer?) -> Result) -> Result {
+        var result: Result?
+        RLMObjectBaseWithUnsafeBytes(self, propertyName) { bytes, length in
+            result = body(bytes.map { UnsafeRawBufferPointer(start: $0, count: Int(length)) })
+        }
+        return result!
+    }
+}
+
 /**
  Information about a specific property which changed in an `Object` change notification.
  */
@@ -240,9 +240,16 @@ public struct Query<T> {
     /// - Returns: A tuple containing the predicate string and an array of arguments.
 
     /// Creates an NSPredicate from the query expression.
+    ///
+    /// When possible this is an `RLMQueryExpression`, which is converted
+    /// directly to a query without formatting and parsing a predicate string.
     internal var predicate: NSPredicate {
-        let predicate = _constructPredicate()
-        return NSPredicate(format: predicate.0, argumentArray: predicate.1)
+        let node = self.node
+        func buildNSPredicate() -> NSPredicate {
+            let predicate = buildPredicate(node)
+            return NSPredicate(format: predicate.0, argumentArray: predicate.1)
+        }
+        return QueryExpressionEncoder.encode(node, buildNSPredicate) ?? buildNSPredicate()
     }
 }
 
@@ -1094,6 +1101,134 @@ private func buildPredicate(_ root: QueryNode, subqueryCount: Int = 0) -> (Strin
     return (formatStr as String, (arguments as! [Any]))
 }
 
+/// Serializes a `QueryNode` tree into the instruction format read by
+/// `RLMQueryExpression`. Nodes which have no direct representation (subqueries
+/// and subscripts) make the whole query fall back to an `NSPredicate`.
+private struct QueryExpressionEncoder {
+    private var instructions = [UInt32]()
+    private var keyPaths = [String]()
+    private let values = NSMutableArray()
+
+    static func encode(_ root: QueryNode, _ buildNSPredicate: @escaping () -> NSPredicate) -> NSPredicate? {
+        var encoder = QueryExpressionEncoder()
+        guard encoder.encodePredicate(root) else {
+            return nil
+        }
+        return encoder.instructions.withUnsafeBytes { bytes in
+            RLMQueryExpression(instructions: Data(bytes), keyPaths: encoder.keyPaths,
+                               values: encoder.values as! [Any], predicateBuilder: buildNSPredicate)
+        }
+    }
+
+    private mutating func emit(_ instruction: RLMQueryInstruction) {
+        instructions.append(instruction.rawValue)
+    }
+
+    private mutating func emitComparison(_ op: NSComparisonPredicate.Operator, _ lhs: QueryNode,
+                                         _ rhs: QueryNode, options: StringOptions) -> Bool {
+        var modifier = NSComparisonPredicate.Modifier.direct
+        if case let .keyPath(_, lhsOptions) = lhs, lhsOptions.contains(.requiresAny) {
+            modifier = .any
+        }
+        if case let .keyPath(_, rhsOptions) = rhs, rhsOptions.contains(.requiresAny) {
+            return false
+        }
+
+        var predicateOptions = NSComparisonPredicate.Options()
+        if options.contains(.caseInsensitive) {
+            predicateOptions.insert(.caseInsensitive)
+        }
+        if options.contains(.diacriticInsensitive) {
+            predicateOptions.insert(.diacriticInsensitive)
+        }
+
+        emit(.compare)
+        instructions.append(UInt32(op.rawValue))
+        instructions.append(UInt32(predicateOptions.rawValue))
+        instructions.append(UInt32(modifier.rawValue))
+        return encodeOperand(lhs) && encodeOperand(rhs)
+    }
+
+    private mutating func emitConstant(_ value: Any) {
+        emit(.constant)
+        instructions.append(UInt32(values.count))
+        values.add(value)
+    }
+
+    private mutating func encodeOperand(_ node: QueryNode) -> Bool {
+        switch node {
+        case .constant(let value):
+            emitConstant(value ?? NSNull())
+            return true
+        case .keyPath(let kp, _):
+            guard !kp.isEmpty else { return false }
+            emit(.keyPath)
+            instructions.append(UInt32(keyPaths.count))
+            keyPaths.append(kp.joined(separator: "."))
+            return true
+        default:
+            return false
+        }
+    }
+
+    private mutating func encodePredicate(_ node: QueryNode) -> Bool {
+        switch node {
+        case .keyPath:
+            // A bare boolean property
+            return emitComparison(.equalTo, node, .constant(true), options: [])
+        case .not(let child):
+            switch child {
+            case .keyPath:
+                return emitComparison(.equalTo, child, .constant(false), options: [])
+            case .comparison:
+                emit(.not)
+                return encodePredicate(child)
+            default:
+                return false
+            }
+        case .comparison(operator: let op, let lhs, let rhs, let options):
+            switch op {
+            case .and, .or:
+                emit(op == .and ? .and : .or)
+                return encodePredicate(lhs) && encodePredicate(rhs)
+            default:
+                if case let .keyPath(_, lhsOptions) = lhs,
+                   case let .keyPath(_, rhsOptions) = rhs,
+                   lhsOptions.contains(.isCollection), rhsOptions.contains(.isCollection) {
+                    throwRealmException("Comparing two collection columns is not permitted.")
+                }
+                return emitComparison(op.predicateOperator, lhs, rhs, options: options)
+            }
+        case .between(let lhs, lowerBound: .constant(let lower), upperBound: .constant(let upper)):
+            return emitComparison(.between, lhs, .constant([lower ?? NSNull(), upper ?? NSNull()] as NSArray),
+                                  options: [])
+        case .geoWithin(let keyPath, let value):
+            return emitComparison(.in, keyPath, value, options: [])
+        default:
+            return false
+        }
+    }
+}
+
+private extension QueryNode.Operator {
+    var predicateOperator: NSComparisonPredicate.Operator {
+        switch self {
+        case .equal: return .equalTo
+        case .notEqual: return .notEqualTo
+        case .lessThan: return .lessThan
+        case .lessThanEqual: return .lessThanOrEqualTo
+        case .greaterThan: return .greaterThan
+        case .greaterThanEqual: return .greaterThanOrEqualTo
+        case .in: return .in
+        case .contains: return .contains
+        case .beginsWith: return .beginsWith
+        case .endsWith: return .endsWith
+        case .like: return .like
+        case .and, .or: preconditionFailure("Compound operators are not comparisons")
+        }
+    }
+}
+
 private struct KeyPathOptions: OptionSet {
     let rawValue: Int8
     init(rawValue: RawValue) {
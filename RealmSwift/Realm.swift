@@ -574,9 +574,7 @@ public typealias AsyncTransactionId = RLMAsyncTransactionId
      Realm. Must be `.error` for object types without a primary key.
      */
     public func add<S: Sequence>(_ objects: S, update: UpdatePolicy = .error) where S.Iterator.Element: Object {
-        for obj in objects {
-            add(obj, update: update)
-        }
+        RLMAddObjectsToRealm(Array(objects) as NSArray, rlmRealm, RLMUpdatePolicy(rawValue: UInt(update.rawValue))!)
     }
 
     /**
@@ -696,9 +694,7 @@ public typealias AsyncTransactionId = RLMAsyncTransactionId
                             elements are `Object`s (subject to the caveats above).
      */
     public func delete<S: Sequence>(_ objects: S) where S.Iterator.Element: ObjectBase {
-        for obj in objects {
-            delete(obj)
-        }
+        RLMDeleteObjectsFromRealm(Array(objects) as NSArray, rlmRealm)
     }
 
     /**
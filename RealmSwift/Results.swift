@@ -82,6 +82,64 @@ extension String: SortableType {}
 extension Optional: SortableType where Wrapped: SortableType {}
 
 
+// MARK: ColumnReadableType
+
+/**
+ Types of properties which can be read in bulk with `withUnsafeBufferPointer(of:range:_:)`. Optional properties cannot
+ be read in bulk.
+ */
+public protocol ColumnReadableType {
+    /// :nodoc:
+    static func _rlmReadColumn(_ results: RLMResults<AnyObject>, _ property: String,
+                               _ buffer: UnsafeMutablePointer<Self>, _ range: NSRange)
+}
+extension Int64: ColumnReadableType {
+    /// :nodoc:
+    public static func _rlmReadColumn(_ results: RLMResults<AnyObject>, _ property: String,
+                                      _ buffer: UnsafeMutablePointer<Self>, _ range: NSRange) {
+        results.readInt64Column(property, into: buffer, range: range)
+    }
+}
+extension Int: ColumnReadableType {
+    /// :nodoc:
+    public static func _rlmReadColumn(_ results: RLMResults<AnyObject>, _ property: String,
+                                      _ buffer: UnsafeMutablePointer<Self>, _ range: NSRange) {
+        if MemoryLayout<Int>.size == MemoryLayout<Int64>.size {
+            buffer.withMemoryRebound(to: Int64.self, capacity: range.length) {
+                results.readInt64Column(property, into: $0, range: range)
+            }
+            return
+        }
+        withUnsafeTemporaryAllocation(of: Int64.self, capacity: range.length) { values in
+            results.readInt64Column(property, into: values.baseAddress!, range: range)
+            for i in 0..<range.length {
+                (buffer + i).initialize(to: Int(truncatingIfNeeded: values[i]))
+            }
+        }
+    }
+}
+extension Double: ColumnReadableType {
+    /// :nodoc:
+    public static func _rlmReadColumn(_ results: RLMResults<AnyObject>, _ property: String,
+                                      _ buffer: UnsafeMutablePointer<Self>, _ range: NSRange) {
+        results.readDoubleColumn(property, into: buffer, range: range)
+    }
+}
+extension Float: ColumnReadableType {
+    /// :nodoc:
+    public static func _rlmReadColumn(_ results: RLMResults<AnyObject>, _ property: String,
+                                      _ buffer: UnsafeMutablePointer<Self>, _ range: NSRange) {
+        results.readFloatColumn(property, into: buffer, range: range)
+    }
+}
+extension Bool: ColumnReadableType {
+    /// :nodoc:
+    public static func _rlmReadColumn(_ results: RLMResults<AnyObject>, _ property: String,
+                                      _ buffer: UnsafeMutablePointer<Self>, _ range: NSRange) {
+        results.readBoolColumn(property, into: buffer, range: range)
+    }
+}
+
 /**
  Types which have properties that can be sorted or distincted on.
  */
@@ -240,3 +298,73 @@ extension Projection: KeypathSortable {}
 }
 
 extension Results: Encodable where Element: Encodable {}
+
+extension Results where Element: ObjectBase {
+    /**
+     Calls the given closure with a buffer containing the values of a property
+     for the objects in the given range of the results.
+
+     The values are copied directly out of the Realm file into a single
+     contiguous buffer without creating an object for each element, which is
+     much faster than mapping over the results when reading a single property
+     from a large number of objects.
+
+     Only non-optional `Int`, `Int64`, `Double`, `Float` and `Bool` properties
+     can be read, as optional types do not conform to `ColumnReadableType`.
+
+     - warning: The buffer is only valid for the duration of the closure and
+                must not be escaped from it.
+
+     - parameter keyPath: The property to read.
+     - parameter range: The range of objects to read. Defaults to all objects
+                        in the results.
+     - parameter body: A closure which is passed a buffer containing the values.
+     - returns: The value returned by `body`.
+     */
+    public func withUnsafeBufferPointer<Value: ColumnReadableType, Result>(
+        of keyPath: KeyPath<Element, Value>,
+        range: Range<Int>? = nil,
+        _ body: (UnsafeBufferPointer<Value>) throws -> Result
+    ) rethrows -> Result {
+        let range = range ?? 0..<count
+        let results = ObjectiveCSupport.convert(object: self)
+        let property = _name(for: keyPath)
+        return try withUnsafeTemporaryAllocation(of: Value.self, capacity: range.count) { buffer in
+            guard let baseAddress = buffer.baseAddress, !range.isEmpty else {
+                return try body(UnsafeBufferPointer(start: nil, count: 0))
+            }
+            Value._rlmReadColumn(results, property, baseAddress, NSRange(range))
+            return try body(UnsafeBufferPointer(buffer))
+        }
+    }
+
+    /**
+     Computes the count, minimum, maximum, sum and average of each of the given
+     properties in a single pass over the results.
+
+     This is much faster than calling `min(of:)`, `max(of:)`, `sum(of:)` and
+     `average(of:)` separately when several aggregates are needed. `nil` values
+     are excluded from every aggregate, and integer values are converted to
+     `Double`.
+
+     ```swift
+     let aggregates = people.aggregate(\.age, \.weight)
+     print(aggregates[0].average, aggregates[1].max)
+     ```
+
+     - parameter keyPaths: The properties to aggregate. Only `Int`, `Float` and
+                           `Double` properties and their optional forms are
+                           supported.
+     - returns: The aggregates for each property, in the same order as `keyPaths`.
+     */
+    public func aggregate(_ keyPaths: PartialKeyPath<Element>...) -> [AggregateResult] {
+        let results = ObjectiveCSupport.convert(object: self)
+        let properties = keyPaths.map(_name(for:))
+        return [AggregateResult](unsafeUninitializedCapacity: properties.count) { buffer, count in
+            if let baseAddress = buffer.baseAddress {
+                results.aggregateProperties(properties, into: baseAddress)
+            }
+            count = properties.count
+        }
+    }
+}
@@ -805,6 +805,79 @@ class MigrationTests: TestCase {
         }
     }
 
+    func testCopyValues() throws {
+        try autoreleasepool {
+            let prop = RLMProperty(name: "before_stringCol", type: .int, objectClassName: nil,
+                linkOriginPropertyName: nil, indexed: false, optional: false)
+            try autoreleasepool {
+                let realm = realmWithSingleClassProperties(defaultRealmURL(), className: "SwiftStringObject",
+                    properties: [prop])
+                try realm.transaction {
+                    for i in 0..<10 {
+                        realm.createObject("SwiftStringObject", withValue: [i])
+                    }
+                }
+            }
+
+            try testMigration { migration, _ in
+                migration.copyValues(ofProperty: "before_stringCol", to: "stringCol", onType: "SwiftStringObject")
+            } validation: { realm, _ in
+                XCTAssertEqual(Set(realm.objects(SwiftStringObject.self).map(\.stringCol)),
+                               Set((0..<10).map(String.init)))
+            }
+        }
+    }
+
+    func testTransformObjects() throws {
+        try autoreleasepool {
+            let prop = RLMProperty(name: "before_stringCol", type: .int, objectClassName: nil,
+                linkOriginPropertyName: nil, indexed: false, optional: false)
+            try autoreleasepool {
+                let realm = realmWithSingleClassProperties(defaultRealmURL(), className: "SwiftStringObject",
+                    properties: [prop])
+                try realm.transaction {
+                    for i in 0..<10 {
+                        realm.createObject("SwiftStringObject", withValue: [i])
+                    }
+                }
+            }
+
+            try testMigration { migration, _ in
+                migration.transformObjects(ofType: "SwiftStringObject", batchSize: 3) { oldValues in
+                    ["stringCol": "value \(oldValues["before_stringCol"] as! Int)"]
+                }
+            } validation: { realm, _ in
+                XCTAssertEqual(Set(realm.objects(SwiftStringObject.self).map(\.stringCol)),
+                               Set((0..<10).map { "value \($0)" }))
+            }
+        }
+    }
+
+    func testTransformProperty() throws {
+        try autoreleasepool {
+            let prop = RLMProperty(name: "name", type: .string, objectClassName: nil,
+                linkOriginPropertyName: nil, indexed: false, optional: false)
+            try autoreleasepool {
+                let realm = realmWithSingleClassProperties(defaultRealmURL(), className: "SwiftStringObject",
+                    properties: [prop])
+                try realm.transaction {
+                    realm.createObject("SwiftStringObject", withValue: ["Mary Smith"])
+                }
+            }
+
+            try testMigration { migration, _ in
+                migration.transformProperty("name", onType: "SwiftStringObject", to: "stringCol",
+                                            using: .component(separatedBy: " ", at: 1))
+                // Old values are always read from before the migration
+                migration.transformProperty("name", onType: "SwiftStringObject", to: "stringCol") { oldValue in
+                    (oldValue as! String).uppercased()
+                }
+            } validation: { realm, _ in
+                XCTAssertEqual("MARY SMITH", realm.objects(SwiftStringObject.self).first!.stringCol)
+            }
+        }
+    }
+
     // test getting/setting all property types
     func testMigrationObject() throws {
         try autoreleasepool {
@@ -1200,6 +1200,23 @@ class ObjectAccessorTests: TestCase {
         }
     }
 
+    func testPropertiesOfDeletedParentObject() {
+        let realm = try! Realm()
+        let obj = try! realm.write {
+            realm.create(SwiftOptionalObject.self, value: ["optIntCol": 1, "otherIntCol": 1])
+        }
+        let optional = obj.optIntCol
+        let realmProperty = obj.otherIntCol
+        XCTAssertEqual(optional.value, 1)
+        XCTAssertEqual(realmProperty.value, 1)
+
+        try! realm.write {
+            realm.delete(obj)
+        }
+        assertThrows(optional.value, reasonMatching: "invalidated or deleted")
+        assertThrows(realmProperty.value, reasonMatching: "invalidated or deleted")
+    }
+
     func testSetEmbeddedLink() {
         let realm = try! Realm()
         realm.beginWrite()
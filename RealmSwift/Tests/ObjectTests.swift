@@ -1772,6 +1772,70 @@ class ObjectTests: TestCase {
         XCTAssertTrue(testObject.isSameObject(as: retrievedObject))
     }
 
+    func testObjectIdentity() {
+        let realm = try! Realm()
+        let unmanaged = SwiftPrimaryStringObject(value: ["a", 1])
+        XCTAssertNil(unmanaged.objectIdentity)
+        let hash = unmanaged.hash
+
+        let other = SwiftPrimaryStringObject(value: ["b", 2])
+        try! realm.write {
+            realm.add([unmanaged, other])
+        }
+        XCTAssertEqual(unmanaged.hash, hash)
+
+        let retrieved = realm.object(ofType: SwiftPrimaryStringObject.self, forPrimaryKey: "a")!
+        XCTAssertNotNil(unmanaged.objectIdentity)
+        XCTAssertEqual(unmanaged.objectIdentity, retrieved.objectIdentity)
+        XCTAssertNotEqual(unmanaged.objectIdentity, other.objectIdentity)
+
+        let identities = Set(realm.objects(SwiftPrimaryStringObject.self).compactMap(\.objectIdentity))
+        XCTAssertEqual(identities.count, 2)
+        XCTAssertTrue(identities.contains(retrieved.objectIdentity!))
+
+        let objects: Set<SwiftPrimaryStringObject> = [unmanaged, other, retrieved]
+        XCTAssertEqual(objects.count, 2)
+    }
+
+    func testHashOfInt8PrimaryKeyIsUnchangedByAdding() {
+        let realm = try! Realm()
+        let objects = (0..<3).map { i in ModernPrimaryInt8Object(value: [Int8(i)]) }
+        let hashes = objects.map(\.hash)
+        try! realm.write {
+            realm.add(objects)
+        }
+        XCTAssertEqual(objects.map(\.hash), hashes)
+        XCTAssertEqual((0..<3).map { realm.object(ofType: ModernPrimaryInt8Object.self, forPrimaryKey: Int8($0))!.hash },
+                       hashes)
+    }
+
+    func testWithUnsafeBytes() {
+        let data = Data([0, 1, 2, 3])
+        let unmanaged = SwiftOptionalObject()
+        unmanaged.optStringCol = "héllo"
+        unmanaged.optBinaryCol = data
+        XCTAssertEqual(unmanaged.withUnsafeBytes(for: "optStringCol") { $0.map { String(decoding: $0, as: UTF8.self) } }, "héllo")
+        XCTAssertEqual(unmanaged.withUnsafeBytes(for: "optBinaryCol") { $0.map { Data($0) } }, data)
+        XCTAssertNil(unmanaged.withUnsafeBytes(for: "optNSStringCol") { $0 })
+
+        let realm = try! Realm()
+        try! realm.write {
+            realm.add(unmanaged)
+        }
+        XCTAssertEqual(unmanaged.withUnsafeBytes(for: "optStringCol") { $0.map { String(decoding: $0, as: UTF8.self) } }, "héllo")
+        XCTAssertEqual(unmanaged.withUnsafeBytes(for: "optBinaryCol") { $0?.count }, 4)
+        XCTAssertEqual(unmanaged.withUnsafeBytes(for: "optBinaryCol") { $0.map { Data($0) } }, data)
+        XCTAssertNil(unmanaged.withUnsafeBytes(for: "optNSStringCol") { $0 })
+
+        unmanaged.withUnsafeBytes(for: "optStringCol") { _ in
+            XCTAssertFalse(realm.autorefresh)
+        }
+        XCTAssertTrue(realm.autorefresh)
+
+        assertThrows(unmanaged.withUnsafeBytes(for: "optIntCol") { $0 },
+                     reason: "only string and data properties can be read as bytes")
+    }
+
     func testEqualityForObjectTypeWithoutPrimaryKey() {
         let realm = try! Realm()
         let pk = "123456"
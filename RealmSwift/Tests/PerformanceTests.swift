@@ -127,6 +127,110 @@ class SwiftPerformanceTests: TestCase {
         }
     }
 
+    private func primaryKeyObjects() -> Results<SwiftPrimaryStringObject> {
+        let realm = inMemoryRealm("primaryKeyObjects")
+        try! realm.write {
+            for i in 0..<20_000 {
+                realm.create(SwiftPrimaryStringObject.self, value: [String(i), i])
+            }
+        }
+        return realm.objects(SwiftPrimaryStringObject.self)
+    }
+
+    func testHashPrimaryKeyObjects() {
+        let objects = Array(primaryKeyObjects())
+        measure {
+            let set = Set(objects)
+            XCTAssertEqual(set.count, 20_000)
+        }
+    }
+
+    func testHashObjectIdentities() {
+        let objects = Array(primaryKeyObjects())
+        measure {
+            let set = Set(objects.lazy.map { $0.objectIdentity! })
+            XCTAssertEqual(set.count, 20_000)
+        }
+    }
+
+    private func largeBinaryObjects() -> Results<SwiftOptionalObject> {
+        let realm = inMemoryRealm("largeBinaryObjects")
+        let data = Data(repeating: 1, count: 1024 * 1024)
+        try! realm.write {
+            for _ in 0..<20 {
+                realm.create(SwiftOptionalObject.self, value: ["optBinaryCol": data])
+            }
+        }
+        return realm.objects(SwiftOptionalObject.self)
+    }
+
+    func testReadLargeBinaryProperty() {
+        let objects = Array(largeBinaryObjects())
+        measure(times: 10) {
+            var total = 0
+            for obj in objects {
+                total += Int(obj.optBinaryCol!.last!)
+            }
+            XCTAssertEqual(total, 20)
+        }
+    }
+
+    func testReadLargeBinaryPropertyWithUnsafeBytes() {
+        let objects = Array(largeBinaryObjects())
+        measure(times: 10) {
+            var total = 0
+            for obj in objects {
+                total += obj.withUnsafeBytes(for: "optBinaryCol") { Int($0!.last!) }
+            }
+            XCTAssertEqual(total, 20)
+        }
+    }
+
+    func testReadRealmProperty() {
+        let realm = inMemoryRealm("readRealmProperty")
+        let obj = try! realm.write {
+            realm.create(SwiftOptionalObject.self, value: ["otherIntCol": 1])
+        }
+        let property = obj.otherIntCol
+        measure {
+            var total = 0
+            for _ in 0..<100_000 {
+                total += property.value!
+            }
+            XCTAssertEqual(total, 100_000)
+        }
+    }
+
+    func testReadAnyRealmValueProperty() {
+        let realm = inMemoryRealm("readAnyRealmValueProperty")
+        let obj = try! realm.write {
+            realm.create(SwiftObject.self, value: ["anyCol": 1])
+        }
+        let property = obj.anyCol
+        measure {
+            var total = 0
+            for _ in 0..<100_000 {
+                total += property.value.intValue!
+            }
+            XCTAssertEqual(total, 100_000)
+        }
+    }
+
+    func testWriteRealmProperty() {
+        let realm = inMemoryRealm("writeRealmProperty")
+        let obj = try! realm.write {
+            realm.create(SwiftOptionalObject.self)
+        }
+        let property = obj.otherIntCol
+        measure {
+            try! realm.write {
+                for i in 0..<100_000 {
+                    property.value = i
+                }
+            }
+        }
+    }
+
     func testInsertSingleLiteral() {
         inMeasureBlock {
             let realm = self.realmWithTestPath()
@@ -163,6 +267,19 @@ class SwiftPerformanceTests: TestCase {
         }
     }
 
+    func testTypeSafeQueryConstruction() {
+        let realm = copyRealmToTestPath(smallRealm)
+        let results = realm.objects(SwiftStringObject.self)
+        measure {
+            for i in 0..<5000 {
+                let prefix = String(i)
+                _ = results.where {
+                    $0.stringCol.starts(with: prefix, options: .caseInsensitive) || $0.stringCol == prefix
+                }
+            }
+        }
+    }
+
     func testCountWhereTableView() {
         let realm = copyRealmToTestPath(largeRealm)
         measure(times: 50) {
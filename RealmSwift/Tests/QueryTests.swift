@@ -753,6 +753,12 @@ class QueryTests: TestCase {
                                         _ query: ((Query<T>) -> Query<Bool>)) {
         let results = realm.objects(T.self).where(query)
         XCTAssertEqual(results.count, expectedCount, line: line)
+
+        // The query is normally converted directly rather than via a format
+        // string, so check that parsing the format string gives the same result
+        let (queryStr, values) = query(Query<T>._constructForTesting())._constructPredicate()
+        let parsed = realm.objects(T.self).filter(NSPredicate(format: queryStr, argumentArray: values))
+        XCTAssertEqual(parsed.count, expectedCount, line: line)
     }
 
     private func assertPredicate<T: _RealmSchemaDiscoverable>(
@@ -1618,6 +1618,71 @@ class ResultsEquatabilityTests: TestCase {
     }
 }
 
+class ResultsColumnReadTests: TestCase {
+    func testWithUnsafeBufferPointer() {
+        let realm = realmWithTestPath()
+        try! realm.write {
+            for i in 0..<10 {
+                realm.create(CTTAggregateObject.self, value: ["intCol": i, "int64Col": i * 2,
+                                                              "floatCol": Float(i) / 2, "doubleCol": Double(i) * 1.5,
+                                                              "boolCol": i % 2 == 0])
+            }
+        }
+
+        let results = realm.objects(CTTAggregateObject.self)
+        results.withUnsafeBufferPointer(of: \.intCol) { values in
+            XCTAssertEqual(Array(values), Array(0..<10))
+        }
+        results.withUnsafeBufferPointer(of: \.int64Col) { values in
+            XCTAssertEqual(Array(values), (0..<10).map { $0 * 2 })
+        }
+        results.withUnsafeBufferPointer(of: \.floatCol) { values in
+            XCTAssertEqual(Array(values), (0..<10).map { Float($0) / 2 })
+        }
+        results.withUnsafeBufferPointer(of: \.doubleCol) { values in
+            XCTAssertEqual(Array(values), (0..<10).map { Double($0) * 1.5 })
+        }
+        results.withUnsafeBufferPointer(of: \.boolCol) { values in
+            XCTAssertEqual(Array(values), (0..<10).map { $0 % 2 == 0 })
+        }
+
+        let sum = results.where { $0.intCol >= 5 }.withUnsafeBufferPointer(of: \.intCol, range: 1..<3) {
+            $0.reduce(0, +)
+        }
+        XCTAssertEqual(sum, 13)
+        results.withUnsafeBufferPointer(of: \.intCol, range: 3..<3) { values in
+            XCTAssertEqual(values.count, 0)
+        }
+    }
+
+    func testAggregate() {
+        let realm = realmWithTestPath()
+        try! realm.write {
+            for i in 0..<10 {
+                realm.create(CTTAggregateObject.self, value: ["intCol": i, "floatCol": Float(i) / 2,
+                                                              "doubleCol": Double(i) * 1.5])
+            }
+        }
+
+        let results = realm.objects(CTTAggregateObject.self).where { $0.intCol >= 2 }
+        let aggregates = results.aggregate(\.intCol, \.floatCol, \.doubleCol)
+        XCTAssertEqual(aggregates.count, 3)
+        XCTAssertEqual(aggregates[0].count, 8)
+        XCTAssertEqual(aggregates[0].min, 2)
+        XCTAssertEqual(aggregates[0].max, 9)
+        XCTAssertEqual(aggregates[0].sum, 44)
+        XCTAssertEqual(aggregates[0].average, 5.5)
+        XCTAssertEqual(aggregates[1].max, 4.5)
+        XCTAssertEqual(aggregates[2].sum, results.sum(of: \.doubleCol))
+        XCTAssertEqual(aggregates[2].average, results.average(of: \.doubleCol))
+
+        XCTAssertEqual(results.aggregate().count, 0)
+        let empty = results.where { $0.intCol < 0 }.aggregate(\.intCol)
+        XCTAssertEqual(empty[0].count, 0)
+        XCTAssertTrue(empty[0].average.isNaN)
+    }
+}
+
 class ResultsFromTableTests: ResultsTests {
     override func getCollection(_ realm: Realm) -> Results<CTTNullableStringObjectWithLink> {
         return realm.objects(CTTNullableStringObjectWithLink.self)
@@ -407,6 +407,8 @@ class RealmTests: TestCase {
             let objs = [SwiftPrimaryStringObject(), SwiftPrimaryStringObject()]
             realm.add(objs, update: .all)
             XCTAssertEqual(1, realm.objects(SwiftPrimaryStringObject.self).count)
+            assertThrows(realm.add([SwiftPrimaryStringObject(), SwiftObject()], update: .modified),
+                         reason: "'SwiftObject' does not have a primary key and can not be updated")
         }
         XCTAssertEqual(1, realm.objects(SwiftPrimaryStringObject.self).count)
 
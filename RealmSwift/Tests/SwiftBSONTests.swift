@@ -200,4 +200,156 @@ class SwiftBSONTests: XCTestCase {
         let bson: AnyBSON? = ObjectiveCSupport.convert(object: rlmBSON)
         XCTAssertEqual(bson?.value(), swiftArray)
     }
+
+    // MARK: - BSONDecoder
+
+    struct DecodedValues: Decodable {
+        struct Nested: Decodable {
+            let name: String
+            let values: [Int]
+        }
+        let string: String
+        let bool: Bool
+        let int: Int
+        let int8: Int8
+        let int64: Int64
+        let intFromDouble: Int
+        let double: Double
+        let doubleFromInt: Double
+        let date: Date
+        let objectId: ObjectId
+        let decimal: Decimal128
+        let uuid: UUID
+        let data: Data
+        let nested: Nested
+        let optional: String?
+        let null: Int?
+        let missing: Int?
+        let any: AnyBSON
+    }
+
+    func testBSONDecoderScalarsAndNestedValues() throws {
+        let date = Date(timeIntervalSince1970: 1_600_000_000.25)
+        let objectId = ObjectId.generate()
+        let uuid = UUID()
+        let document: Document = [
+            "string": "test string",
+            "bool": true,
+            "int": .int32(5),
+            "int8": .int64(-7),
+            "int64": .int64(10000000000),
+            "intFromDouble": 3.0,
+            "double": 15.5,
+            "doubleFromInt": .int32(2),
+            "date": .datetime(date),
+            "objectId": .objectId(objectId),
+            "decimal": .decimal128(Decimal128("1.2E+10")),
+            "uuid": .uuid(uuid),
+            "data": .binary(Data([1, 2, 3])),
+            "nested": ["name": "nested", "values": [.int32(1), .int64(2), 3.0]],
+            "optional": "present",
+            "null": nil,
+            "unused": ["not": ["decoded"]],
+            "any": ["a": .int32(1)]
+        ]
+
+        let values = try BSONDecoder().decode(DecodedValues.self, from: BSONDocumentView(document))
+        XCTAssertEqual(values.string, "test string")
+        XCTAssertEqual(values.bool, true)
+        XCTAssertEqual(values.int, 5)
+        XCTAssertEqual(values.int8, -7)
+        XCTAssertEqual(values.int64, 10000000000)
+        XCTAssertEqual(values.intFromDouble, 3)
+        XCTAssertEqual(values.double, 15.5)
+        XCTAssertEqual(values.doubleFromInt, 2)
+        XCTAssertEqual(values.date, date)
+        XCTAssertEqual(values.objectId, objectId)
+        XCTAssertEqual(values.decimal, Decimal128("1.2E+10"))
+        XCTAssertEqual(values.uuid, uuid)
+        XCTAssertEqual(values.data, Data([1, 2, 3]))
+        XCTAssertEqual(values.nested.name, "nested")
+        XCTAssertEqual(values.nested.values, [1, 2, 3])
+        XCTAssertEqual(values.optional, "present")
+        XCTAssertNil(values.null)
+        XCTAssertNil(values.missing)
+        XCTAssertEqual(values.any, ["a": .int32(1)])
+    }
+
+    func testBSONDecoderErrors() throws {
+        struct Name: Decodable {
+            let name: String
+        }
+        struct Age: Decodable {
+            let age: UInt8
+        }
+        struct Owner: Decodable {
+            let owner: Name
+        }
+
+        do {
+            _ = try BSONDecoder().decode(Name.self, from: BSONDocumentView(["other": "value"]))
+            XCTFail("Decoding a missing key should have failed")
+        } catch DecodingError.keyNotFound(let key, _) {
+            XCTAssertEqual(key.stringValue, "name")
+        }
+
+        do {
+            _ = try BSONDecoder().decode(Owner.self, from: BSONDocumentView(["owner": ["name": .int32(1)]]))
+            XCTFail("Decoding an integer as a string should have failed")
+        } catch DecodingError.typeMismatch(_, let context) {
+            XCTAssertEqual(context.codingPath.map(\.stringValue), ["owner", "name"])
+        }
+
+        do {
+            _ = try BSONDecoder().decode(Age.self, from: BSONDocumentView(["age": .int32(300)]))
+            XCTFail("Decoding 300 as a UInt8 should have failed")
+        } catch DecodingError.dataCorrupted {
+        }
+
+        do {
+            _ = try BSONDecoder().decode(Age.self, from: BSONDocumentView(["age": 1.5]))
+            XCTFail("Decoding 1.5 as a UInt8 should have failed")
+        } catch DecodingError.dataCorrupted {
+        }
+    }
+
+    func testBSONDecoderRealmObject() throws {
+        let objectId = ObjectId.generate()
+        let date = Date(timeIntervalSince1970: 500.004)
+        let document: Document = [
+            "string": "test string",
+            "int": .int32(5),
+            "date": .datetime(date),
+            "objectId": .objectId(objectId),
+            "decimal": .decimal128(Decimal128("1.5")),
+            "intList": [.int32(1), .int32(2)],
+            "objectOpt": ["value": .int32(10)]
+        ]
+
+        let object = try BSONDecoder().decode(BSONDecodedObject.self, from: BSONDocumentView(document))
+        XCTAssertNil(object.realm)
+        XCTAssertEqual(object.string, "test string")
+        XCTAssertEqual(object.int, 5)
+        XCTAssertEqual(object.date, date)
+        XCTAssertEqual(object.objectId, objectId)
+        XCTAssertEqual(object.decimal, Decimal128("1.5"))
+        XCTAssertEqual(Array(object.intList), [1, 2])
+        XCTAssertEqual(object.objectOpt?.value, 10)
+        XCTAssertNil(object.stringOpt)
+    }
+}
+
+final class BSONDecodedObject: Object, Decodable {
+    @Persisted var string: String
+    @Persisted var int: Int
+    @Persisted var date: Date
+    @Persisted var objectId: ObjectId
+    @Persisted var decimal: Decimal128
+    @Persisted var stringOpt: String?
+    @Persisted var intList: List<Int>
+    @Persisted var objectOpt: BSONDecodedLinkedObject?
+}
+
+final class BSONDecodedLinkedObject: Object, Decodable {
+    @Persisted var value: Int
 }